@@ -1,19 +1,28 @@
 #include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <algorithm>
 #include <iostream>
+#include <sstream>
+#include <cstring>
+#include <cstdio>
 #include <string>
+#include <vector>
 #include <memory>
 
-#include <TString.h>
 #include <TBranch.h>
 #include <TLeaf.h>
 #include <TFile.h>
 #include <TTree.h>
 #include <TTreeCloner.h>
-#include <TList.h>
-#include <TKey.h>
 
 #include <Cintex/Cintex.h>
 
+#include <boost/shared_ptr.hpp>
+
 #include "FWCore/Utilities/interface/Exception.h"
 #include "FWCore/PluginManager/interface/PluginManager.h"
 #include "FWCore/PluginManager/interface/standard.h"
@@ -22,60 +31,257 @@
 #include "PhysicsTools/MVAComputer/interface/MVAComputer.h"
 #include "PhysicsTools/MVAComputer/interface/TreeReader.h"
 
+#include "PhysicsTools/MVATrainer/interface/TreeBranchSelection.h"
+#include "PhysicsTools/MVATrainer/interface/TreeInputSet.h"
+
 using namespace PhysicsTools;
 
-TTree *getTree(const std::string &arg)
+// one calibration, evaluated into its own output branch
+struct Output {
+	std::string		branch;
+	std::string		file;
+	MVAComputer		*mva;
+	Calibration::MVAComputer	*calib;
+	double			discr;
+	TBranch			*discrBranch;
+};
+
+// parses [<branch>=]<file.mva>[,[<branch>=]<file.mva>...], unnamed
+// calibrations are written to __DISCR__ if there is only one of them
+// and to a branch named after the file otherwise
+static std::vector<Output> getOutputs(const std::string &arg)
 {
-	std::string::size_type pos = arg.find('@');
-
-	std::string fileName;
-	if (pos == std::string::npos)
-		fileName = arg;
-	else
-		fileName = arg.substr(pos + 1);
-
-	TFile *file = TFile::Open(fileName.c_str());
-	if (!file) {
-		std::cerr << "ROOT file \"" << fileName << "\" could not be "
-		             "opened for reading." << std::endl;
-		return 0;
+	std::vector<Output> outputs;
+	std::string::size_type pos = 0;
+	do {
+		std::string::size_type end = arg.find(',', pos);
+		std::string item = arg.substr(pos, end == std::string::npos
+		                                   ? end : end - pos);
+		pos = end == std::string::npos ? end : end + 1;
+
+		Output output;
+		std::string::size_type eq = item.find('=');
+		if (eq != std::string::npos) {
+			output.branch = item.substr(0, eq);
+			output.file = item.substr(eq + 1);
+		} else
+			output.file = item;
+		output.mva = 0;
+		output.calib = 0;
+		output.discr = 0.;
+		output.discrBranch = 0;
+		outputs.push_back(output);
+	} while(pos != std::string::npos);
+
+	for(std::vector<Output>::iterator iter = outputs.begin();
+	    iter != outputs.end(); ++iter) {
+		if (!iter->branch.empty())
+			continue;
+		if (outputs.size() == 1) {
+			iter->branch = "__DISCR__";
+			continue;
+		}
+
+		std::string::size_type slash = iter->file.rfind('/');
+		iter->branch = iter->file.substr(slash == std::string::npos
+		                                 ? 0 : slash + 1);
+		std::string::size_type dot = iter->branch.rfind('.');
+		if (dot != std::string::npos && dot > 0)
+			iter->branch.erase(dot);
 	}
 
-	TTree *tree = 0;
-	if (pos == std::string::npos) {
-		TIter next(file->GetListOfKeys());
-		TObject *obj;
-		TString treeName;
-		while((obj = next())) {
-			TString name = static_cast<TKey*>(obj)->GetName();
-			TTree *cur = dynamic_cast<TTree*>(file->Get(name));
-			if (!cur || name == treeName)
-				continue;
+	return outputs;
+}
 
-			if (tree) {
-				std::cerr << "ROOT file \"" << fileName
-				          << "\" contains more than one tree. "
-				             "Please use <tree>@<file> syntax."
-				          << std::endl;
-				return 0;
+// only the branches read by the calibrations are decompressed
+static void selectBranches(TreeBranchSelection &selection,
+                           const std::vector<Output> &outputs)
+{
+	for(std::vector<Output>::const_iterator iter = outputs.begin();
+	    iter != outputs.end(); ++iter)
+		selection.add(iter->calib);
+	selection.apply();
+}
+
+// entries evaluated by a worker in one go, sent through its pipe
+static const Long64_t chunkEntries = 32768;
+
+static bool readAll(int fd, void *buffer, std::size_t size)
+{
+	char *p = static_cast<char*>(buffer);
+	while(size > 0) {
+		ssize_t n = read(fd, p, size);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		size -= n;
+	}
+	return true;
+}
+
+static bool writeAll(int fd, const void *buffer, std::size_t size)
+{
+	const char *p = static_cast<const char*>(buffer);
+	while(size > 0) {
+		ssize_t n = write(fd, p, size);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		size -= n;
+	}
+	return true;
+}
+
+// forked worker: opens its own copy of the input tree and evaluates the
+// chunks worker, worker + nWorkers, ... into the pipe fd, the outputs
+// of an entry are sent one after the other
+static void runWorker(const TreeInputSet::File &input,
+                      std::vector<Output> &outputs,
+                      unsigned int worker, unsigned int nWorkers, int fd,
+                      bool verbose)
+{
+	int status = 1;
+	try {
+		TTree *tree = TreeInputSet::openTree(input.fileName,
+		                                     input.treeName);
+		if (tree) {
+			TreeReader reader(tree, true, true);
+			reader.update();
+
+			TreeBranchSelection selection(tree);
+			selectBranches(selection, outputs);
+
+			unsigned int nOutputs = outputs.size();
+			Long64_t entries = tree->GetEntries();
+			std::vector<double> discr(chunkEntries * nOutputs);
+			status = 0;
+			for(Long64_t first = worker * chunkEntries;
+			    first < entries;
+			    first += nWorkers * chunkEntries) {
+				Long64_t n = std::min(chunkEntries,
+				                      entries - first);
+				double *p = &discr.front();
+				for(Long64_t i = 0; i < n; i++) {
+					tree->GetEntry(first + i);
+					for(unsigned int j = 0; j < nOutputs; j++)
+						*p++ = reader.fill(outputs[j].mva);
+				}
+				if (!writeAll(fd, &discr.front(),
+				              n * nOutputs * sizeof(double))) {
+					status = 1;
+					break;
+				}
 			}
 
-			tree = cur;
-			treeName = name;
+			if (verbose) {
+				std::cout << "Worker " << worker << ": ";
+				selection.report(std::cout);
+			}
+		}
+	} catch(const cms::Exception &e) {
+		std::cerr << e.what() << std::endl;
+		status = 1;
+	} catch(const std::exception &e) {
+		std::cerr << e.what() << std::endl;
+		status = 1;
+	} catch(...) {
+		std::cerr << "Worker " << worker << ": unknown exception."
+		          << std::endl;
+		status = 1;
+	}
+
+	// no destructors or exit handlers of the parent's objects
+	std::cout.flush();
+	std::cerr.flush();
+	std::fflush(0);
+	_exit(status);
+}
+
+// evaluates the entries of the input tree in nWorkers processes, the
+// discriminators are filled into the branches in entry order
+static bool computeParallel(const TreeInputSet::File &input, Long64_t entries,
+                            std::vector<Output> &outputs,
+                            unsigned int nWorkers, bool verbose)
+{
+	unsigned int nOutputs = outputs.size();
+
+	std::vector<pid_t> pids;
+	std::vector<int> pipes;
+	for(unsigned int i = 0; i < nWorkers; i++) {
+		int fd[2];
+		if (pipe(fd) < 0) {
+			std::cerr << "Cannot create pipe: "
+			          << std::strerror(errno) << std::endl;
+			break;
+		}
+#ifdef F_SETPIPE_SZ
+		// room for a few chunks, so the workers run ahead
+		fcntl(fd[1], F_SETPIPE_SZ,
+		      4 * chunkEntries * nOutputs * sizeof(double));
+#endif
+
+		std::cout.flush();
+		std::cerr.flush();
+		std::fflush(0);
+
+		pid_t pid = fork();
+		if (pid < 0) {
+			std::cerr << "Cannot fork worker process: "
+			          << std::strerror(errno) << std::endl;
+			close(fd[0]);
+			close(fd[1]);
+			break;
+		}
+		if (pid == 0) {
+			for(unsigned int j = 0; j < pipes.size(); j++)
+				close(pipes[j]);
+			close(fd[0]);
+			runWorker(input, outputs, i, nWorkers, fd[1], verbose);
+		}
+
+		close(fd[1]);
+		pids.push_back(pid);
+		pipes.push_back(fd[0]);
+	}
+
+	bool ok = pids.size() == nWorkers;
+	std::vector<double> buffer(chunkEntries * nOutputs);
+	for(Long64_t first = 0, chunk = 0; ok && first < entries;
+	    first += chunkEntries, chunk++) {
+		Long64_t n = std::min(chunkEntries, entries - first);
+		if (!readAll(pipes[chunk % nWorkers], &buffer.front(),
+		             n * nOutputs * sizeof(double))) {
+			std::cerr << "Worker process "
+			          << (chunk % nWorkers) << " failed."
+			          << std::endl;
+			ok = false;
+			break;
 		}
-	} else {
-		TString name(arg.substr(0, pos).c_str());
-		tree = dynamic_cast<TTree*>(file->Get(name));
-
-		if (!tree) {
-			std::cerr << "ROOT file \"" << fileName << "\" does "
-			             "not contain a tree named \"" << name
-			          << "\"." << std::endl;
-			return 0;
+
+		const double *p = &buffer.front();
+		for(Long64_t i = 0; i < n; i++) {
+			for(unsigned int j = 0; j < nOutputs; j++) {
+				outputs[j].discr = *p++;
+				outputs[j].discrBranch->Fill();
+			}
 		}
 	}
 
-	return tree;
+	for(unsigned int i = 0; i < pipes.size(); i++)
+		close(pipes[i]);
+
+	for(unsigned int i = 0; i < pids.size(); i++) {
+		int status;
+		while(waitpid(pids[i], &status, 0) < 0 && errno == EINTR);
+		if (!WIFEXITED(status) || WEXITSTATUS(status))
+			ok = false;
+	}
+
+	return ok;
 }
 
 int main(int argc, char **argv)
@@ -88,54 +294,155 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
+	unsigned int jobs = 1;
+	bool friendTree = false;
+	bool verbose = false;
+	std::vector<std::string> copyBranches;
+	char **args = argv + 1;
+	argc--;
+	while(argc > 0 && **args == '-') {
+		if (!std::strcmp(*args, "-j") ||
+		    !std::strcmp(*args, "--jobs")) {
+			args++;
+			argc--;
+			if (argc < 1) {
+				std::cerr << "Option " << args[-1]
+				          << " needs a parameter."
+				          << std::endl;
+				continue;
+			}
+			std::istringstream ss(*args);
+			ss >> jobs;
+			if (ss.fail() || jobs < 1) {
+				jobs = 1;
+				std::cerr << "Option " << args[-1]
+				          << " has an invalid argument."
+				          << std::endl;
+				continue;
+			}
+		} else if (!std::strcmp(*args, "-v") ||
+		           !std::strcmp(*args, "--verbose"))
+			verbose = true;
+		else if (!std::strcmp(*args, "-f") ||
+		           !std::strcmp(*args, "--friend"))
+			friendTree = true;
+		else if (!std::strcmp(*args, "-c") ||
+		         !std::strcmp(*args, "--copy")) {
+			args++;
+			argc--;
+			if (argc < 1) {
+				std::cerr << "Option " << args[-1]
+				          << " needs a parameter."
+				          << std::endl;
+				continue;
+			}
+			copyBranches.push_back(*args);
+		} else
+			std::cerr << "Unsupported option " << *args
+			          << "." << std::endl;
+		args++;
+		argc--;
+	}
+
 	if (argc < 3) {
-		std::cerr << "Syntax: " << argv[0] << " <input.mva> "
-		             "<output.root> <input.root> [<input2.root>...]\n";
+		std::cerr << "Syntax: " << argv[0] << " <input.mva>(,...) "
+		             "<output.root> <input.root> [<input2.root>...]\n\n";
+		std::cerr << "Recognized parameters:\n"
+		             "\t-j <n> / --jobs <n>\tEvaluate in <n> worker processes.\n"
+		             "\t-f / --friend\t\tWrite only the outputs, as a friend of the input.\n"
+		             "\t-c <branch> / --copy <branch>\n"
+		             "\t\t\t\tAlso copy <branch> into the friend tree.\n"
+		             "\t-v / --verbose\t\tReport the bytes read from the inputs.\n\n";
+		std::cerr << "Calibrations can be given as "
+		             "(<branch>=)<file name>, separated by commas.\n";
 		std::cerr << "Trees can be selected as "
-		             "(<tree name>@)<file name>" << std::endl;
+		             "(<tree name>@)<file name>, where the file name "
+		             "can be a\npattern or a .list/.txt file naming "
+		             "one file per line." << std::endl;
 		return 1;
 	}
 
 	ROOT::Cintex::Cintex::Enable();
 
 	try {
-		std::vector<TTree*> trees;
-		for(int i = 3; i < argc; i++) {
-			TTree *tree = getTree(argv[i]);
-			if (!tree)
+		// the files are opened one by one, each only once it is copied
+		TreeInputSet inputs;
+		for(int i = 2; i < argc; i++)
+			if (!inputs.add(args[i]))
 				return 1;
-			trees.push_back(tree);
-		}
 
-		Calibration::MVAComputer *calib =
-				MVAComputer::readCalibration(argv[1]);
-		if (!calib) {
-			std::cerr << "MVA calibration could not be read."
-		                  << std::endl;
-			return 1;
+		std::vector<TreeInputSet::File> files;
+		for(unsigned int i = 0; i < inputs.size(); i++)
+			files.insert(files.end(), inputs.getFiles(i).begin(),
+			             inputs.getFiles(i).end());
+
+		std::vector<Output> outputs = getOutputs(args[0]);
+		std::vector<boost::shared_ptr<MVAComputer> > computers;
+		for(std::vector<Output>::iterator iter = outputs.begin();
+		    iter != outputs.end(); ++iter) {
+			Calibration::MVAComputer *calib =
+				MVAComputer::readCalibration(
+							iter->file.c_str());
+			if (!calib) {
+				std::cerr << "MVA calibration \""
+				          << iter->file << "\" could not be "
+				             "read." << std::endl;
+				return 1;
+			}
+			computers.push_back(boost::shared_ptr<MVAComputer>(
+					new MVAComputer(calib, true)));
+			iter->mva = computers.back().get();
+			iter->calib = calib;
 		}
-		MVAComputer mva(calib, true);
 
-		TFile *outFile = TFile::Open(argv[2], "RECREATE");
+		TFile *outFile = TFile::Open(args[1], "RECREATE");
 		if (!outFile) {
 			std::cerr << "Output file could not be created."
 		                  << std::endl;
 			return 1;
 		}
 		TTree *outTree = 0;
-		TBranch *discrBranch = 0;
-		double discr = 0.;
+		Long64_t inputBytes = 0;
+
+		for(std::vector<TreeInputSet::File>::iterator iter =
+				files.begin(); iter != files.end(); ++iter) {
+			TTree *tree = TreeInputSet::openTree(iter->fileName,
+			                                     iter->treeName);
+			if (!tree)
+				return 1;
 
-		for(std::vector<TTree*>::const_iterator iter = trees.begin();
-		    iter != trees.end(); ++iter) {
-			TTree *tree = *iter;
+			// the tree found without <tree>@, for the workers and
+			// the friend
+			iter->treeName = tree->GetName();
+
+			// only the selected branches are cloned in friend mode
+			if (friendTree) {
+				tree->SetBranchStatus("*", 0);
+				for(std::vector<std::string>::const_iterator
+					name = copyBranches.begin();
+				    name != copyBranches.end(); ++name)
+					tree->SetBranchStatus(name->c_str(), 1);
+			}
 
 			if (!outTree) {
 				outTree = tree->CloneTree(0);
 				outTree->SetDirectory(outFile);
-				discrBranch = outTree->Branch("__DISCR__",
-				                              &discr,
-				                              "__DISCR__/D");
+				for(std::vector<Output>::iterator output =
+							outputs.begin();
+				    output != outputs.end(); ++output) {
+					const char *name =
+						output->branch.c_str();
+					if (outTree->GetBranch(name)) {
+						std::cerr << "Output branch \""
+						          << name << "\" "
+						             "already exists."
+						          << std::endl;
+						return 1;
+					}
+					output->discrBranch = outTree->Branch(
+						name, &output->discr,
+						(output->branch + "/D").c_str());
+				}
 			}
 
 			TTreeCloner cloner(tree, outTree, "");
@@ -145,21 +452,60 @@ int main(int argc, char **argv)
 				return 1;
 			}
 
-			TreeReader reader(tree, true, true);
-			reader.update();
-
 			Long64_t entries = tree->GetEntries();
 			outTree->SetEntries(outTree->GetEntries() + entries);
 			cloner.Exec();
+			inputBytes += tree->GetZipBytes();
 
+			if (friendTree)
+				tree->SetBranchStatus("*", 1);
+
+			if (jobs > 1) {
+				if (!computeParallel(*iter, entries, outputs, jobs,
+				                     verbose))
+					return 1;
+				continue;
+			}
+
+			TreeReader reader(tree, true, true);
+			reader.update();
+
+			TreeBranchSelection selection(tree);
+			selectBranches(selection, outputs);
+
+			// all calibrations share the entry read and the reader
 			for(Long64_t entry = 0; entry < entries; entry++) {
 				tree->GetEntry(entry);
-				discr = reader.fill(&mva);
-				discrBranch->Fill();
+				for(std::vector<Output>::iterator output =
+							outputs.begin();
+				    output != outputs.end(); ++output) {
+					output->discr =
+						reader.fill(output->mva);
+					output->discrBranch->Fill();
+				}
 			}
+
+			if (verbose)
+				selection.report(std::cout);
+			selection.release();
 		}
 
+		if (friendTree && files.size() == 1) {
+			std::string name = "input=" + files.front().treeName;
+			outTree->AddFriend(name.c_str(),
+			                   files.front().fileName.c_str());
+		} else if (friendTree)
+			std::cout << "Friend tree is aligned with the chain "
+			             "of the input trees in the given order."
+			          << std::endl;
+
 		outTree->Write();
+
+		if (friendTree)
+			std::cout << "Wrote " << (outTree->GetZipBytes() >> 10)
+			          << " kB instead of copying "
+			          << (inputBytes >> 10) << " kB of input "
+			             "baskets." << std::endl;
 	} catch(const cms::Exception &e) {
 		std::cerr << e.what() << std::endl;
 	}
@@ -4,11 +4,7 @@
 #include <string>
 #include <memory>
 
-#include <TString.h>
-#include <TFile.h>
 #include <TTree.h>
-#include <TList.h>
-#include <TKey.h>
 
 #include <Cintex/Cintex.h>
 
@@ -19,64 +15,11 @@
 #include "PhysicsTools/MVAComputer/interface/Calibration.h"
 #include "PhysicsTools/MVAComputer/interface/MVAComputer.h"
 
+#include "PhysicsTools/MVATrainer/interface/TreeInputSet.h"
 #include "PhysicsTools/MVATrainer/interface/TreeTrainer.h"
 
 using namespace PhysicsTools;
 
-TTree *getTree(const std::string &arg)
-{
-	std::string::size_type pos = arg.find('@');
-
-	std::string fileName;
-	if (pos == std::string::npos)
-		fileName = arg;
-	else
-		fileName = arg.substr(pos + 1);
-
-	TFile *file = TFile::Open(fileName.c_str());
-	if (!file) {
-		std::cerr << "ROOT file \"" << fileName << "\" could not be "
-		             "opened for reading." << std::endl;
-		return 0;
-	}
-
-	TTree *tree = 0;
-	if (pos == std::string::npos) {
-		TIter next(file->GetListOfKeys());
-		TObject *obj;
-		TString treeName;
-		while((obj = next())) {
-			TString name = static_cast<TKey*>(obj)->GetName();
-			TTree *cur = dynamic_cast<TTree*>(file->Get(name));
-			if (!cur || name == treeName)
-				continue;
-
-			if (tree) {
-				std::cerr << "ROOT file \"" << fileName
-				          << "\" contains more than one tree. "
-				             "Please use <tree>@<file> syntax."
-				          << std::endl;
-				return 0;
-			}
-
-			tree = cur;
-			treeName = name;
-		}
-	} else {
-		TString name(arg.substr(0, pos).c_str());
-		tree = dynamic_cast<TTree*>(file->Get(name));
-
-		if (!tree) {
-			std::cerr << "ROOT file \"" << fileName << "\" does "
-			             "not contain a tree named \"" << name
-			          << "\"." << std::endl;
-			return 0;
-		}
-	}
-
-	return tree;
-}
-
 int main(int argc, char **argv)
 {
 	try {
@@ -92,7 +35,13 @@ int main(int argc, char **argv)
 	bool monitoring = true;
 	bool weights = true;
 	bool useXSLT = false;
+	bool verbose = false;
+	double readAhead = 30.0;
+	double unzipBuffer = 0.0;
+	unsigned int openJobs = 16;
 	double crossValidation = -1.0;
+	double wallBudget = 0.0;
+	double cpuBudget = 0.0;
 	const char *styleSheet = 0;
 	char **args = argv + 1;
 	argc--;
@@ -115,6 +64,48 @@ int main(int argc, char **argv)
 		} else if (!std::strcmp(*args, "-x") || 
 		           !std::strcmp(*args, "--xslt"))
 			useXSLT = true;
+		else if (!std::strcmp(*args, "--verbose"))
+			verbose = true;
+		else if (!std::strcmp(*args, "--open-jobs")) {
+			args++;
+			argc--;
+			if (argc < 1) {
+				std::cerr << "Option " << args[-1]
+				          << " needs a parameter."
+				          << std::endl;
+				continue;
+			}
+			std::istringstream ss(*args);
+			ss >> openJobs;
+			if (ss.fail() || openJobs < 1) {
+				openJobs = 16;
+				std::cerr << "Option " << args[-1]
+				          << " has an invalid argument."
+				          << std::endl;
+				continue;
+			}
+		} else if (!std::strcmp(*args, "--read-ahead") ||
+		         !std::strcmp(*args, "--unzip-buffer")) {
+			double &size = std::strcmp(*args, "--unzip-buffer")
+			               ? readAhead : unzipBuffer;
+			args++;
+			argc--;
+			if (argc < 1) {
+				std::cerr << "Option " << args[-1]
+				          << " needs a parameter."
+				          << std::endl;
+				continue;
+			}
+			std::istringstream ss(*args);
+			ss >> size;
+			if (ss.fail() || size < 0.0) {
+				size = &size == &readAhead ? 30.0 : 0.0;
+				std::cerr << "Option " << args[-1]
+				          << " has an invalid argument."
+				          << std::endl;
+				continue;
+			}
+		}
 		else if (!std::strcmp(*args, "-v") ||
 		         !std::strcmp(*args, "--cross-validation")) {
 			args++;
@@ -135,6 +126,28 @@ int main(int argc, char **argv)
 				          << std::endl;
 				continue;
 			}
+		} else if (!std::strcmp(*args, "-t") ||
+		           !std::strcmp(*args, "--time-budget") ||
+		           !std::strcmp(*args, "--cpu-budget")) {
+			double &budget = std::strcmp(*args, "--cpu-budget")
+			                 ? wallBudget : cpuBudget;
+			args++;
+			argc--;
+			if (argc < 1) {
+				std::cerr << "Option " << *args
+				          << " needs a parameter."
+				          << std::endl;
+				continue;
+			}
+			std::istringstream ss(*args);
+			ss >> budget;
+			if (!(budget > 0.0)) {
+				budget = 0.0;
+				std::cerr << "Option " << args[-1]
+				          << " has an invalid argument."
+				          << std::endl;
+				continue;
+			}
 		} else
 			std::cerr << "Unsupported option " << *args
 			          << "." << std::endl;
@@ -154,9 +167,19 @@ int main(int argc, char **argv)
 		             "\t-w / --no-weights\tIgnore __WEIGHT__ branches.\n"
 		             "\t-x / --xslt\t\tUse MVATrainer XSLT parsing.\n"
 		             "\t-v <arg> / --cross-validation <arg>\n"
-		             "\t\t\t\tUse <arg> test/train sample split ratio (0..1).\n\n";
+		             "\t\t\t\tUse <arg> test/train sample split ratio (0..1).\n"
+		             "\t-t <sec> / --time-budget <sec>\n"
+		             "\t\t\t\tFinish the training within <sec> seconds.\n"
+		             "\t--cpu-budget <sec>\tUse at most <sec> seconds of CPU time.\n"
+		             "\t--verbose\t\tReport the bytes read from the trees.\n"
+		             "\t--read-ahead <MB>\tSize of the tree read cache.\n"
+		             "\t--unzip-buffer <MB>\tBasket unzipping ahead, 0 (default) disables.\n"
+		             "\t--open-jobs <n>\tOpen the input files in <n> processes.\n\n";
 		std::cerr << "Trees can be selected as "
-		             "(<tree name>@)<file name>" << std::endl;
+		             "(<tree name>@)<file name>, where the file name "
+		             "can be a\npattern or a .list/.txt file naming "
+		             "one file per line, read as one chain."
+		          << std::endl;
 		return 1;
 	}
 
@@ -166,14 +189,21 @@ int main(int argc, char **argv)
 
 	try {
 		std::auto_ptr<TreeTrainer> treeTrainer;
+		TreeInputSet inputs;
+		for(int i = 2; i < argc; i++)
+			if (!inputs.add(args[i]))
+				return 1;
+		if (!inputs.scan(openJobs))
+			return 1;
+
 		std::vector<TTree*> trees;
 		unsigned int nTarget = 0;
-		for(int i = 2; i < argc; i++) {
-			TTree *tree = getTree(args[i]);
+		for(unsigned int i = 0; i < inputs.size(); i++) {
+			TTree *tree = inputs.getTree(i);
 			if (!tree)
 				return 1;
 			trees.push_back(tree);
-			if (tree->GetBranch("__TARGET__"))
+			if (inputs.hasTarget(i))
 				nTarget++;
 		}
 
@@ -193,11 +223,17 @@ int main(int argc, char **argv)
 			             "signal and background tree has to be "
 			             "specified." << std::endl;
                             
+		treeTrainer->setVerbose(verbose);
+		treeTrainer->setPrefetch((Long64_t)(readAhead * 1048576.0),
+		                         (Long64_t)(unzipBuffer * 1048576.0));
+
 		MVATrainer trainer(args[0], useXSLT, styleSheet);
 		trainer.setMonitoring(monitoring);
 		trainer.setAutoSave(save);
 		if (crossValidation > 0.0)
 			trainer.setCrossValidation(crossValidation);
+		if (wallBudget > 0.0 || cpuBudget > 0.0)
+			trainer.setTimeBudget(wallBudget, cpuBudget);
 		if (load)
 			trainer.loadState();
 
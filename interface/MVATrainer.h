@@ -36,6 +36,10 @@ class MVATrainer {
 	inline void setRandomSeed(UInt_t seed) { randomSeed = seed; }
 	inline void setCrossValidation(double split) { crossValidation = split; }
 
+	// limits the wall-clock and/or CPU time (in seconds, counted from
+	// this call) available for the training, zero means no limit
+	void setTimeBudget(double wallTime, double cpuTime = 0.0);
+
 	void loadState();
 	void saveState();
 
@@ -52,6 +56,11 @@ class MVATrainer {
 
 	inline const std::string &getName() const { return name; }
 
+	// seconds proc may spend on its training, keeping the estimated
+	// cost of the passes still needed by the other processors, or
+	// negative without a time budget
+	double getTimeLeft(const TrainProcessor *proc, bool cpu = false) const;
+
 	TrainerMonitoring::Module *bookMonitor(const std::string &name);
 
 	// constants
@@ -113,6 +122,15 @@ class MVATrainer {
 
 	UInt_t					randomSeed;
 	double					crossValidation;
+
+	double					wallBudget;
+	double					cpuBudget;
+	double					wallStart;
+	double					cpuStart;
+	mutable double				passWallStart;
+	mutable double				passCPUStart;
+	mutable double				passWallTime;
+	mutable double				passCPUTime;
 };
 
 } // namespace PhysicsTools
@@ -0,0 +1,64 @@
+#ifndef PhysicsTools_MVATrainer_ReservoirSampler_h
+#define PhysicsTools_MVATrainer_ReservoirSampler_h
+
+#include <utility>
+#include <vector>
+
+#include <TRandom.h>
+
+namespace PhysicsTools {
+
+// Weighted reservoir sampling of an event stream of unknown length
+// (algorithm A-ExpJ by Efraimidis and Spirakis)
+//
+// offer() decides for each event whether it is kept and in which slot,
+// the event data itself is stored by the caller.  Each event has a key
+// u^(1/|w|) and the events with the largest keys are kept.  Once the
+// reservoir is full, a random number only decides how much weight is
+// skipped until the next replacement, so most events cost a subtraction.
+//
+// getWeight() is the weight of a kept event divided by its probability
+// to be kept given the smallest key in the reservoir, so that weighted
+// sums over the kept events estimate the sums over all offered events
+// without bias.  The event with the smallest key only provides this
+// threshold and has weight zero.
+
+class ReservoirSampler {
+    public:
+	ReservoirSampler(unsigned int capacity, UInt_t seed = 65539);
+	~ReservoirSampler();
+
+	// slot to store the event in, or -1 if it is not kept
+	int offer(double weight);
+
+	double getWeight(unsigned int slot) const;
+
+	inline unsigned int size() const { return slots.size(); }
+	inline unsigned int getCapacity() const { return capacity; }
+	inline unsigned long getOffered() const { return offered; }
+	inline double getOfferedWeight() const { return offeredWeight; }
+
+    private:
+	struct Slot {
+		double	weight;
+		double	logKey;
+	};
+
+	// log(key) and slot, smallest key on top
+	typedef std::pair<double, unsigned int> Entry;
+
+	void jump();
+
+	unsigned int		capacity;
+	std::vector<Slot>	slots;
+	std::vector<Entry>	heap;
+	TRandom			random;
+	double			skip;
+	unsigned long		offered;
+	unsigned long		candidates;
+	double			offeredWeight;
+};
+
+} // namespace PhysicsTools
+
+#endif // PhysicsTools_MVATrainer_ReservoirSampler_h
@@ -0,0 +1,80 @@
+#ifndef PhysicsTools_MVATrainer_TreeBranchSelection_h
+#define PhysicsTools_MVATrainer_TreeBranchSelection_h
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <set>
+
+#include <TObject.h>
+#include <TTree.h>
+
+#include "PhysicsTools/MVAComputer/interface/Calibration.h"
+
+namespace PhysicsTools {
+
+// Restricts the branches read from a tree to the ones a calibration
+// takes as input variables.  apply() disables all other branches, so
+// GetEntry() only decompresses the selected ones, and sets up a
+// TTreeCache holding exactly those branches.  Names without a branch in
+// the tree (variables filled by other means) are ignored.
+//
+// For a TChain the sizes are added up over the files loaded so far (all
+// of them once every entry has been read).
+
+class TreeBranchSelection {
+    public:
+	TreeBranchSelection(TTree *tree);
+	~TreeBranchSelection();
+
+	void add(const std::string &name);
+	void add(const Calibration::MVAComputer *calib);
+
+	void apply(Long64_t cacheSize = 30000000);
+
+	// enables all branches again and drops the cache
+	void release();
+
+	// bytes read from all input files since apply()
+	Long64_t getBytesRead() const;
+
+	// compressed size of the selected / of all branches
+	inline Long64_t getSelectedBytes() const { return selectedBytes; }
+	inline Long64_t getTotalBytes() const { return totalBytes; }
+
+	void report(std::ostream &out) const;
+
+    private:
+	// called by a TChain after loading the tree of the next file
+	class FileNotify : public TObject {
+	    public:
+		FileNotify(TreeBranchSelection *selection, TObject *next) :
+			selection(selection), next(next) {}
+
+		virtual Bool_t Notify();
+
+		TreeBranchSelection	*selection;
+		TObject			*next;
+	};
+
+	// the chain points to this object
+	TreeBranchSelection(const TreeBranchSelection &orig);
+	TreeBranchSelection &operator = (const TreeBranchSelection &orig);
+
+	void select(TBranch *branch);
+	void addFile();
+	void removeNotify();
+
+	TTree			*tree;
+	std::set<std::string>	names;
+	std::vector<std::string> selected;
+	std::set<Int_t>		files;	// tree numbers added up
+	Long64_t		selectedBytes;
+	Long64_t		totalBytes;
+	Long64_t		startBytes;
+	FileNotify		*notify;
+};
+
+} // namespace PhysicsTools
+
+#endif // PhysicsTools_MVATrainer_TreeBranchSelection_h
@@ -0,0 +1,47 @@
+#ifndef PhysicsTools_MVATrainer_TreeExportOptions_h
+#define PhysicsTools_MVATrainer_TreeExportOptions_h
+
+#include <string>
+
+#include <TFile.h>
+#include <TTree.h>
+
+#include <xercesc/dom/DOM.hpp>
+
+namespace PhysicsTools {
+
+// Storage settings of the trees exported by trainer processors, read
+// from an <export/> tag in their config section:
+//
+//   compression	"none", "zlib", "lzma" or "lz4" (ROOT 6)
+//   level		compression level 1..9
+//   basket		basket size per branch in bytes
+//   autoflush		cluster size in bytes
+//   float		"true": store the variables as 32 bit floats
+
+class TreeExportOptions {
+    public:
+	TreeExportOptions();
+
+	void configure(XERCES_CPP_NAMESPACE_QUALIFIER DOMElement *elem);
+
+	void apply(TFile *file) const;
+	void apply(TTree *tree) const;
+
+	inline Int_t getBasketSize() const { return basketSize; }
+	inline bool useFloat() const { return floatStorage; }
+
+	// ROOT leaf type of the variables, 'F' or 'D'
+	inline char getType() const { return floatStorage ? 'F' : 'D'; }
+
+    private:
+	Int_t		algorithm;
+	Int_t		level;
+	Int_t		basketSize;
+	Long64_t	autoFlush;
+	bool		floatStorage;
+};
+
+} // namespace PhysicsTools
+
+#endif // PhysicsTools_MVATrainer_TreeExportOptions_h
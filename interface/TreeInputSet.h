@@ -0,0 +1,67 @@
+#ifndef PhysicsTools_MVATrainer_TreeInputSet_h
+#define PhysicsTools_MVATrainer_TreeInputSet_h
+
+#include <string>
+#include <vector>
+
+#include <TTree.h>
+
+namespace PhysicsTools {
+
+// Input trees given on the command line as (<tree name>@)<file name>.
+//
+// The file name may be a glob pattern, or a file ending in ".list" or
+// ".txt" naming one input file (or pattern) per line.  All files of one
+// argument are read as one TChain.
+//
+// scan() opens all files before any tree is read, in several worker
+// processes, so that with many files on a network file system the
+// startup is not the sum of all open latencies.  The workers find the
+// trees, count their entries and look for the __TARGET__ branch, the
+// chains are then set up from these numbers and open each file only when
+// they get to it.
+
+class TreeInputSet {
+    public:
+	struct File {
+		std::string	fileName;
+		std::string	treeName;	// found by scan() if not given
+		Long64_t	entries;
+		bool		hasTarget;
+	};
+
+	TreeInputSet();
+	~TreeInputSet();
+
+	// adds the files of one argument, false if none matches
+	bool add(const std::string &arg);
+
+	// false if a file cannot be opened or has no unique tree
+	bool scan(unsigned int nWorkers = 16);
+
+	inline unsigned int size() const { return groups.size(); }
+	inline const std::vector<File> &getFiles(unsigned int group) const
+	{ return groups[group]; }
+
+	Long64_t getEntries(unsigned int group) const;
+
+	// true if the trees of all files contain __TARGET__
+	bool hasTarget(unsigned int group) const;
+
+	// a TChain over all files of the group, of the known entries
+	TTree *getTree(unsigned int group) const;
+
+	static TTree *openTree(const std::string &fileName,
+	                       const std::string &treeName);
+
+    private:
+	bool scanFile(File &file) const;
+	void runWorker(unsigned int worker, unsigned int nWorkers,
+	               int fd) const;
+
+	std::vector<std::vector<File> >	groups;
+};
+
+} // namespace PhysicsTools
+
+#endif // PhysicsTools_MVATrainer_TreeInputSet_h
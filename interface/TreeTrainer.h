@@ -36,8 +36,23 @@ class TreeTrainer {
 	bool iteration(MVATrainer *trainer);
 	void train(MVATrainer *trainer);
 
+	// report the bytes read and the time waited for them per tree
+	// and iteration
+	void setVerbose(bool verbose) { this->verbose = verbose; }
+
+	// TTreeCache size and buffer of the parallel basket unzipping
+	// (0, the default: no unzip thread, negative: ROOT default size)
+	void setPrefetch(Long64_t readAhead, Long64_t unzipBuffer);
+
     private:
+	void loop(unsigned int index, const Calibration::MVAComputer *calib,
+	          const MVAComputer *computer);
+
 	std::vector<TreeReader>	readers;
+	std::vector<TTree*>	trees;		// 0 for external readers
+	Long64_t		readAhead;
+	Long64_t		unzipBuffer;
+	bool			verbose;
 
 	std::vector<double*>	weights;
 };
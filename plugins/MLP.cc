@@ -8,6 +8,7 @@
 #include "FWCore/Utilities/interface/Exception.h"
 
 #include "MLP.h"
+#include "MLPPatternStore.h"
 
 #include "mlp_gen.h"
 
@@ -15,6 +16,17 @@ namespace PhysicsTools {
 
 bool MLP::inUse = false;
 
+// pattern stores of the (only) MLP instance, for the read-ahead hook
+static const MLPPatternStore *prefetchStore[2] = { 0, 0 };
+
+extern "C" {
+	static void prefetchPatterns(int ifile, int ipat, int npat)
+	{
+		if (prefetchStore[ifile])
+			prefetchStore[ifile]->prefetch(ipat, npat);
+	}
+}
+
 static std::vector<std::string> split(const std::string line, char delim)
 {
 	const char *str = line.c_str();
@@ -40,7 +52,8 @@ static std::vector<std::string> split(const std::string line, char delim)
 	return tokens;
 }
 
-MLP::MLP(unsigned int nIn, unsigned int nOut, const std::string layout_) :
+MLP::MLP(unsigned int nIn, unsigned int nOut, const std::string layout_,
+         int method) :
 	initialized(false), layers(0), layout(0), epoch(0)
 {
 	if (inUse)
@@ -48,6 +61,11 @@ MLP::MLP(unsigned int nIn, unsigned int nOut, const std::string layout_) :
 			<< "mlpfit doesn't support more than one instance."
 			<< std::endl;
 
+	if (method < 1 || method > 7)
+		throw cms::Exception("MLP")
+			<< "Invalid learning method " << method << "."
+			<< std::endl;
+
 	std::vector<std::string> parsed = split(layout_, ':');
 	if (parsed.size() < 1)
 		throw cms::Exception("MLP")
@@ -73,7 +91,7 @@ MLP::MLP(unsigned int nIn, unsigned int nOut, const std::string layout_) :
 	inUse = true;
 
 	MLP_SetNet(&layers, layout);
-	setLearn();
+	setLearn(method);
 	LearnAlloc();
 	InitWeights();
 }
@@ -83,6 +101,11 @@ MLP::~MLP()
 	clear();
 
 	LearnFree();
+	NThreads = 1;
+	NBatch = 0;
+	PatFloat = 0;
+	ShuffleBlock = 0;
+	ShuffleReorder = 0;
 	inUse = false;
 	delete[] layout;
 }
@@ -94,14 +117,25 @@ void MLP::clear()
 	initialized = false;
 
 	FreePatterns(0);
+	FreePatterns(1);
 	free(PAT.Rin);
+	free(PAT.RinF);
 	free(PAT.Rans);
 	free(PAT.Pond);
+	free(PAT.vRin);
+	free(PAT.vRinF);
+	free(ExamplesIndex);
+	free(PatBuf);
+	ExamplesIndex = 0;
+	PatBuf = 0;
+	ExamplesMemory = 0;
+	MLP_PatternPrefetch = 0;
+	prefetchStore[0] = prefetchStore[1] = 0;
 }
 
-void MLP::setLearn(void)
+void MLP::setLearn(int method)
 {
-	LEARN.Meth = 7;
+	LEARN.Meth = method;
 	LEARN.Nreset = 50;
 	LEARN.Tau = 1.5;
 	LEARN.Decay = 1.0;
@@ -111,6 +145,33 @@ void MLP::setLearn(void)
 	LEARN.epsilon = 0.2;
 }
 
+void MLP::setThreads(unsigned int threads)
+{
+	NThreads = threads > 0 ? (int)threads : 1;
+}
+
+void MLP::setBatch(int size)
+{
+	NBatch = size;
+}
+
+void MLP::setPrecision(Precision precision)
+{
+	if (initialized)
+		throw cms::Exception("MLP")
+			<< "Pattern precision has to be set before init()."
+			<< std::endl;
+
+	PatFloat = (int)precision;
+}
+
+// block < 0: automatic block size, 0: full shuffle (no blocks)
+void MLP::setShuffle(int block, unsigned int reorder)
+{
+	ShuffleBlock = block;
+	ShuffleReorder = (int)reorder;
+}
+
 void MLP::setNPattern(unsigned int size)
 {
 	PAT.Npat[0] = (int)size;
@@ -126,12 +187,91 @@ void MLP::init(unsigned int rows)
 	initialized = true;
 }
 
+void MLP::setPatterns(int file, const MLPPatternStore &patterns)
+{
+	unsigned int rows = patterns.size();
+
+	if (patterns.getNIn() != (unsigned int)layout[0] ||
+	    patterns.getNOut() != (unsigned int)layout[layers - 1])
+		throw cms::Exception("MLP")
+			<< "Pattern store does not match network layout."
+			<< std::endl;
+
+	if (patterns.isSinglePrecision() != (PatFloat != 0))
+		throw cms::Exception("MLP")
+			<< "Pattern store precision does not match."
+			<< std::endl;
+
+	if (!rows)
+		throw cms::Exception("MLP")
+			<< "No patterns." << std::endl;
+
+	// mlpfit takes over the tables, the patterns stay in the store
+	double **rin = 0;
+	float **rinf = 0;
+	if (PatFloat)
+		rinf = (float**)malloc(rows * sizeof(float*));
+	else
+		rin = (double**)malloc(rows * sizeof(double*));
+	double **rans = (double**)malloc(rows * sizeof(double*));
+	double *pond = (double*)malloc(rows * sizeof(double));
+
+	if ((!rin && !rinf) || !rans || !pond) {
+		free(rin);
+		free(rinf);
+		free(rans);
+		free(pond);
+		throw cms::Exception("MLP")
+			<< "Out of memory." << std::endl;
+	}
+
+	for(unsigned int i = 0; i < rows; i++) {
+		if (PatFloat)
+			rinf[i] = patterns.getRowF(i);
+		else
+			rin[i] = patterns.getRow(i);
+		rans[i] = patterns.getTarget(i);
+		pond[i] = patterns.getWeight(i);
+	}
+
+	if (MLP_SetPatterns(file, rows, rin, rinf, rans, pond) != 0)
+		throw cms::Exception("MLP")
+			<< "Out of memory." << std::endl;
+
+	if (patterns.isFileBacked()) {
+		prefetchStore[file] = &patterns;
+		MLP_PatternPrefetch = prefetchPatterns;
+	}
+}
+
+void MLP::init(const MLPPatternStore &patterns)
+{
+	setNPattern(patterns.size());
+	initialized = true;
+	setPatterns(0, patterns);
+}
+
+void MLP::setValidation(const MLPPatternStore &patterns)
+{
+	if (!initialized)
+		throw cms::Exception("MLP")
+			<< "Validation patterns have to be set after init()."
+			<< std::endl;
+
+	setPatterns(1, patterns);
+}
+
 void MLP::set(unsigned int row, double *data, double *target, double weight)
 {
 	int nIn = layout[0];
 	int nOut = layout[layers - 1];
 
-	std::memcpy(&PAT.vRin[0][row*(nIn + 1) + 1], data, sizeof(double) * nIn);
+	if (PatFloat) {
+		float *in = PAT.RinF[0][row];
+		for(int i = 0; i < nIn; i++)
+			in[i] = (float)data[i];
+	} else
+		std::memcpy(PAT.Rin[0][row], data, sizeof(double) * nIn);
 	std::memcpy(&PAT.Rans[0][row][0], target, sizeof(double) * nOut);
 	PAT.Pond[0][row] = weight;
 }
@@ -144,6 +284,15 @@ double MLP::train()
 	return MLP_Epoch(++epoch, &alpMin, &nTest);
 }
 
+double MLP::test() const
+{
+	if (PAT.Npat[1] <= 0)
+		throw cms::Exception("MLP")
+			<< "No validation patterns." << std::endl;
+
+	return MLP_Test(1, 0);
+}
+
 const double *MLP::eval(double *data) const
 {
 	MLP_Out_T(data);
@@ -151,6 +300,17 @@ const double *MLP::eval(double *data) const
 	return &NET.Outn[layers - 1][0];
 }
 
+// all weights, layer by layer, each neuron as bias followed by the
+// weights of the previous layer (the order of the weights file)
+void MLP::getWeights(std::vector<double> &weights) const
+{
+	weights.clear();
+	for(int layer = 1; layer < layers; layer++)
+		weights.insert(weights.end(), NET.vWeights[layer],
+		               NET.vWeights[layer] +
+		               layout[layer] * (layout[layer - 1] + 1));
+}
+
 void MLP::save(const std::string file) const
 {
 	if (SaveWeights(const_cast<char*>(file.c_str()), (int)epoch) < 0)
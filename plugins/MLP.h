@@ -1,18 +1,38 @@
 #ifndef __private_MLP_h
 #define __private_MLP_h
 
+#include <string>
+#include <vector>
+
 namespace PhysicsTools {
 
+class MLPPatternStore;
+
 class MLP {
     public:
-	MLP(unsigned int nIn, unsigned int nOut, const std::string layout);
+	enum Precision {
+		PRECISION_DOUBLE = 0,	// double patterns and computation
+		PRECISION_FLOAT_STORE,	// float patterns, double computation
+		PRECISION_FLOAT		// float patterns and input layer
+	};
+
+	MLP(unsigned int nIn, unsigned int nOut, const std::string layout,
+	    int method = 7);
 	~MLP();
 
 	void clear();
 	void init(unsigned int rows);
+	void init(const MLPPatternStore &patterns);
+	void setValidation(const MLPPatternStore &patterns);
 	void set(unsigned int row, double *data, double *target, double weight = 1.0);
 	double train();
+	double test() const;
 	const double *eval(double *data) const;
+	void setThreads(unsigned int threads);
+	void setBatch(int size);
+	void setPrecision(Precision precision);
+	void setShuffle(int block, unsigned int reorder = 0);
+	void getWeights(std::vector<double> &weights) const;
 	void save(const std::string file) const;
 	void load(const std::string file);
 
@@ -21,8 +41,9 @@ class MLP {
 	inline const int *getLayout() const { return layout; }
 
     private:
-	void		setLearn(void);
+	void		setLearn(int method);
 	void		setNPattern(unsigned int size);
+	void		setPatterns(int file, const MLPPatternStore &patterns);
 
 	bool		initialized;
 	int		layers;
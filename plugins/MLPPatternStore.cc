@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "MLPPatternStore.h"
+
+namespace PhysicsTools {
+
+// size of the input rows block of a chunk
+static const std::size_t rowBlockBytes = 4 << 20;
+
+MLPPatternStore::MLPPatternStore(unsigned int nIn, unsigned int nOut,
+                                 bool singlePrecision,
+                                 const std::string &file) :
+	nIn(nIn), nOut(nOut), singlePrecision(singlePrecision),
+	rowSize((nIn + 1) * (singlePrecision ? sizeof(float)
+	                                     : sizeof(double))),
+	chunkSize(rowBlockBytes / rowSize), count(0), fd(-1),
+	lastChunk(0), advised(0)
+{
+	if (chunkSize < 1)
+		chunkSize = 1;
+
+	// rows, targets and weights in one block, doubles aligned
+	chunkBytes = ((chunkSize * rowSize + 7) & ~7) +
+	             chunkSize * (nOut + 1) * sizeof(double);
+
+	if (file.empty())
+		return;
+
+	// mappings have to start at page boundaries in the file
+	std::size_t page = sysconf(_SC_PAGESIZE);
+	chunkBytes = (chunkBytes + page - 1) / page * page;
+
+	fd = open(file.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+	if (fd < 0)
+		throw cms::Exception("MLPPatternStore")
+			<< "Pattern file \"" << file << "\" cannot be "
+			   "created: " << std::strerror(errno) << std::endl;
+
+	// only referenced through fd from now on, gone when closed
+	unlink(file.c_str());
+}
+
+MLPPatternStore::~MLPPatternStore()
+{
+	for(std::vector<Chunk>::iterator iter = chunks.begin();
+	    iter != chunks.end(); ++iter) {
+		if (fd >= 0)
+			munmap(iter->rows, chunkBytes);
+		else
+			std::free(iter->rows);
+	}
+
+	if (fd >= 0)
+		close(fd);
+}
+
+void MLPPatternStore::addChunk()
+{
+	Chunk chunk;
+
+	if (fd >= 0) {
+		off_t offset = (off_t)chunks.size() * chunkBytes;
+
+		// reserve the disk space now rather than SIGBUS later
+		int err = posix_fallocate(fd, offset, chunkBytes);
+		if (err)
+			throw cms::Exception("MLPPatternStore")
+				<< "Cannot extend pattern file for pattern "
+				<< count << ": " << std::strerror(err)
+				<< std::endl;
+
+		void *addr = mmap(0, chunkBytes, PROT_READ | PROT_WRITE,
+		                  MAP_SHARED, fd, offset);
+		if (addr == MAP_FAILED)
+			throw cms::Exception("MLPPatternStore")
+				<< "Cannot map pattern file for pattern "
+				<< count << ": " << std::strerror(errno)
+				<< std::endl;
+
+		madvise(addr, chunkBytes, MADV_SEQUENTIAL);
+		chunk.rows = static_cast<char*>(addr);
+	} else {
+		chunk.rows = static_cast<char*>(std::malloc(chunkBytes));
+		if (!chunk.rows)
+			throw cms::Exception("MLPPatternStore")
+				<< "Out of memory storing pattern "
+				<< count << "." << std::endl;
+	}
+
+	chunk.targets = reinterpret_cast<double*>(chunk.rows +
+		((chunkSize * rowSize + 7) & ~7));
+	chunk.weights = chunk.targets + chunkSize * nOut;
+	chunks.push_back(chunk);
+}
+
+void MLPPatternStore::add(const double *data, const double *target,
+                          double weight)
+{
+	if (count % chunkSize == 0)
+		addChunk();
+
+	set(count++, data, target, weight);
+}
+
+void MLPPatternStore::set(unsigned int pattern, const double *data,
+                          const double *target, double weight)
+{
+	unsigned int index = pattern % chunkSize;
+
+	const Chunk &chunk = this->chunk(pattern);
+	if (singlePrecision) {
+		float *in = reinterpret_cast<float*>(row(pattern));
+		in[0] = 1.0;
+		for(unsigned int i = 0; i < nIn; i++)
+			in[i + 1] = (float)data[i];
+	} else {
+		double *in = reinterpret_cast<double*>(row(pattern));
+		in[0] = 1.0;
+		std::memcpy(in + 1, data, nIn * sizeof(double));
+	}
+	std::memcpy(chunk.targets + index * nOut, target,
+	            nOut * sizeof(double));
+	chunk.weights[index] = weight;
+}
+
+void MLPPatternStore::setWeight(unsigned int pattern, double weight)
+{
+	chunk(pattern).weights[pattern % chunkSize] = weight;
+}
+
+double *MLPPatternStore::getRow(unsigned int pattern) const
+{
+	return singlePrecision ? 0 :
+		reinterpret_cast<double*>(row(pattern)) + 1;
+}
+
+float *MLPPatternStore::getRowF(unsigned int pattern) const
+{
+	return singlePrecision ?
+		reinterpret_cast<float*>(row(pattern)) + 1 : 0;
+}
+
+double *MLPPatternStore::getTarget(unsigned int pattern) const
+{
+	return chunk(pattern).targets + (pattern % chunkSize) * nOut;
+}
+
+double MLPPatternStore::getWeight(unsigned int pattern) const
+{
+	return chunk(pattern).weights[pattern % chunkSize];
+}
+
+// Patterns first .. first + n - 1 are about to be read in ascending
+// order: have the chunks they live in and the following chunk read in
+// asynchronously.  Each chunk is advised once per sequential sweep.
+void MLPPatternStore::prefetch(unsigned int first, unsigned int n) const
+{
+	if (fd < 0 || first >= count)
+		return;
+
+	unsigned int begin = first / chunkSize;
+	unsigned int end = (first + (n ? n - 1 : 0)) / chunkSize + 2;
+	if (end > chunks.size())
+		end = chunks.size();
+
+	if (begin < lastChunk || first == 0)	// new sweep
+		advised = begin;
+	lastChunk = begin;
+
+	for(unsigned int i = std::max(advised, begin); i < end; i++)
+		madvise(chunks[i].rows, chunkBytes, MADV_WILLNEED);
+
+	if (end > advised)
+		advised = end;
+}
+
+// Replace the shared file mappings by private copy-on-write mappings of
+// the same file ranges at the same addresses: the patterns are unchanged
+// but later modifications stay in this process.
+void MLPPatternStore::makePrivate()
+{
+	if (fd < 0)
+		return;
+
+	for(unsigned int i = 0; i < chunks.size(); i++) {
+		off_t offset = (off_t)i * chunkBytes;
+		void *addr = mmap(chunks[i].rows, chunkBytes,
+		                  PROT_READ | PROT_WRITE,
+		                  MAP_PRIVATE | MAP_FIXED, fd, offset);
+		if (addr == MAP_FAILED)
+			throw cms::Exception("MLPPatternStore")
+				<< "Cannot map pattern file privately: "
+				<< std::strerror(errno) << std::endl;
+		madvise(addr, chunkBytes, MADV_SEQUENTIAL);
+	}
+}
+
+} // namespace PhysicsTools
@@ -0,0 +1,90 @@
+#ifndef __private_MLPPatternStore_h
+#define __private_MLPPatternStore_h
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace PhysicsTools {
+
+// Growable training pattern store for the MLP
+//
+// Patterns are appended in fixed size chunks which are never moved or
+// reallocated, so the store can be filled while the input data is read
+// for the first time (the number of patterns does not have to be known
+// in advance) and handed to mlpfit by pointer afterwards.
+//
+// Each input row is preceded by a constant 1 (the bias input), as
+// expected by mlpfit.  Inputs are kept in single precision if requested.
+//
+// If a file name is given, the chunks are page aligned memory mappings
+// of that (immediately unlinked) file instead of heap memory, so the
+// store can be larger than the physical memory.  prefetch() is then
+// used to ask the kernel to read ahead of sequential epochs.
+//
+// Stored patterns can be overwritten with set(), e.g. to keep a random
+// sample of the input data.
+//
+// After a fork, the heap chunks are private copy-on-write memory of
+// each process.  makePrivate() does the same for the file mappings, so
+// that a process can reorder the patterns without affecting the others.
+
+class MLPPatternStore {
+    public:
+	MLPPatternStore(unsigned int nIn, unsigned int nOut,
+	                bool singlePrecision = false,
+	                const std::string &file = std::string());
+	~MLPPatternStore();
+
+	void add(const double *data, const double *target,
+	         double weight = 1.0);
+	void set(unsigned int pattern, const double *data,
+	         const double *target, double weight = 1.0);
+	void setWeight(unsigned int pattern, double weight);
+
+	inline unsigned int size() const { return count; }
+	inline unsigned int getNIn() const { return nIn; }
+	inline unsigned int getNOut() const { return nOut; }
+	inline bool isSinglePrecision() const { return singlePrecision; }
+	inline bool isFileBacked() const { return fd >= 0; }
+
+	double *getRow(unsigned int pattern) const;
+	float *getRowF(unsigned int pattern) const;
+	double *getTarget(unsigned int pattern) const;
+	double getWeight(unsigned int pattern) const;
+
+	void prefetch(unsigned int first, unsigned int n) const;
+	void makePrivate();
+
+    private:
+	struct Chunk {
+		char	*rows;
+		double	*targets;
+		double	*weights;
+	};
+
+	MLPPatternStore(const MLPPatternStore &orig);
+	MLPPatternStore &operator = (const MLPPatternStore &orig);
+
+	void addChunk();
+
+	inline const Chunk &chunk(unsigned int pattern) const
+	{ return chunks[pattern / chunkSize]; }
+
+	inline char *row(unsigned int pattern) const
+	{ return chunk(pattern).rows + (pattern % chunkSize) * rowSize; }
+
+	unsigned int		nIn, nOut;
+	bool			singlePrecision;
+	std::size_t		rowSize;
+	unsigned int		chunkSize;
+	std::size_t		chunkBytes;
+	unsigned int		count;
+	std::vector<Chunk>	chunks;
+	int			fd;
+	mutable unsigned int	lastChunk, advised;
+};
+
+} // namespace PhysicsTools
+
+#endif // __private_MLPPatternStore_h
@@ -4,10 +4,22 @@
 #include <fstream>
 #include <cstddef>
 #include <cstring>
+#include <cctype>
+#include <cstdio>
+#include <cerrno>
 #include <vector>
+#include <map>
 #include <memory>
 #include <cmath>
 
+#include <stdint.h>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
 #include <TRandom.h>
 
 #include <xercesc/dom/DOM.hpp>
@@ -19,10 +31,12 @@
 #include "PhysicsTools/MVATrainer/interface/XMLDocument.h"
 #include "PhysicsTools/MVATrainer/interface/XMLSimpleStr.h"
 #include "PhysicsTools/MVATrainer/interface/MVATrainer.h"
+#include "PhysicsTools/MVATrainer/interface/ReservoirSampler.h"
 #include "PhysicsTools/MVATrainer/interface/SourceVariable.h"
 #include "PhysicsTools/MVATrainer/interface/TrainProcessor.h"
 
 #include "MLP.h"
+#include "MLPPatternStore.h"
 
 XERCES_CPP_NAMESPACE_USE
 
@@ -44,25 +58,79 @@ class ProcMLP : public TrainProcessor {
 	virtual void trainBegin();
 	virtual void trainData(const std::vector<double> *values,
 	                       bool target, double weight);
+	virtual void testData(const std::vector<double> *values,
+	                      bool target, double weight, bool trainedOn);
 	virtual void trainEnd();
 
 	virtual bool load();
 	virtual void cleanup();
 
     private:
-	void runMLPTrainer();
+	double boostWeight(const std::vector<double> *values,
+	                   bool target, double weight) const;
+	void fillPattern(const std::vector<double> *values, bool target);
+	struct Reservoir;
+	void storePattern(MLPPatternStore &store, Reservoir *reservoir,
+	                  double weight);
+	void finishReservoirs();
+	double runMLPTrainer(const std::string &weightsFile,
+	                     const std::string &label);
+	double trainVariant(unsigned int index, const std::string &weightsFile,
+	                    const std::string &label);
+	void runWorker(unsigned int index, int fd);
+	void keepWeights();
+	void saveWeights(const std::string &fileName) const;
+	bool loadWeights(const std::string &fileName);
+	void exportWeights(const std::string &fileName) const;
+	void trainEnsemble();
+	std::string variantLabel(unsigned int index) const;
 
 	enum Iteration {
-		ITER_COUNT,
 		ITER_TRAIN,
-		ITER_WAIT,
 		ITER_DONE
 	} iteration;
 
-	std::string		layout;
+	struct Variant {
+		std::string	layout;
+		long		seed;		// < 0: random() not reseeded
+		double		error;
+		bool		ok;
+	};
+
+	// random sample of the patterns of one class
+	struct Reservoir {
+		Reservoir(unsigned int size, UInt_t seed) :
+			sampler(size, seed) {}
+
+		ReservoirSampler		sampler;
+		std::vector<unsigned int>	patterns;	// per slot
+	};
+
+	std::vector<Variant>	variants;
+	unsigned int		workers;
+	bool			textWeights;
+	std::vector<unsigned int> neurons;
+	std::vector<double>	weights;
+	unsigned int		weightsEpoch;
 	unsigned int		steps;
-	unsigned int		count, row;
+	unsigned int		patience;
+	double			minDelta;
+	int			method;
+	unsigned int		threads;
+	int			batch;
+	MLP::Precision		precision;
+	bool			fileStore;
+	int			shuffleBlock;
+	unsigned int		reorder;
+	double			wallLimit;	// < 0: no time budget
+	double			cpuLimit;
+	unsigned int		reservoirSize;
+	double			reservoirMemory;
+	std::auto_ptr<Reservoir> reservoirs[4];	// (validation) sig/bkg
 	double			weightSum;
+	double			validationWeightSum;
+	std::auto_ptr<MLPPatternStore>	patterns;
+	std::auto_ptr<MLPPatternStore>	validation;
 	std::auto_ptr<MLP>	mlp;
 	std::vector<double>	vars;
 	std::vector<double>	targets;
@@ -74,12 +142,66 @@ class ProcMLP : public TrainProcessor {
 
 static ProcMLP::Registry registry("ProcMLP");
 
+static std::vector<std::string> splitList(const std::string &list)
+{
+	std::vector<std::string> result;
+	std::string item;
+
+	for(std::string::const_iterator iter = list.begin();; ++iter) {
+		if (iter == list.end() || *iter == ',' ||
+		    std::isspace((unsigned char)*iter)) {
+			if (!item.empty())
+				result.push_back(item);
+			item.clear();
+			if (iter == list.end())
+				break;
+		} else
+			item += *iter;
+	}
+
+	return result;
+}
+
+// CRC-32 (as in zlib), to check the binary weights file
+static uint32_t crc32(uint32_t crc, const char *data, std::size_t size)
+{
+	static uint32_t table[256];
+	if (!table[1])
+		for(uint32_t i = 0; i < 256; i++) {
+			uint32_t c = i;
+			for(unsigned int k = 0; k < 8; k++)
+				c = (c & 1) ? 0xedb88320U ^ (c >> 1) : c >> 1;
+			table[i] = c;
+		}
+
+	crc = ~crc;
+	while(size--)
+		crc = table[(crc ^ (unsigned char)*data++) & 0xff] ^ (crc >> 8);
+	return ~crc;
+}
+
 ProcMLP::ProcMLP(const char *name, const AtomicId *id,
                  MVATrainer *trainer) :
 	TrainProcessor(name, id, trainer),
-	iteration(ITER_COUNT),
-	count(0),
+	iteration(ITER_TRAIN),
+	workers(1),
+	textWeights(false),
+	weightsEpoch(0),
+	patience(0),
+	minDelta(0.0),
+	method(7),
+	threads(1),
+	batch(0),
+	precision(MLP::PRECISION_DOUBLE),
+	fileStore(false),
+	shuffleBlock(0),
+	reorder(0),
+	wallLimit(-1.0),
+	cpuLimit(-1.0),
+	reservoirSize(0),
+	reservoirMemory(0.0),
 	weightSum(0.0),
+	validationWeightSum(0.0),
 	needCleanup(false),
 	boost(-1),
 	limiter(0.0)
@@ -111,8 +233,123 @@ void ProcMLP::configure(DOMElement *elem)
 	boost = XMLDocument::readAttribute<int>(elem, "boost", -1);
 	limiter = XMLDocument::readAttribute<double>(elem, "limiter", 0);
 	steps = XMLDocument::readAttribute<unsigned int>(elem, "steps");
+	patience = XMLDocument::readAttribute<unsigned int>(elem, "patience", 0);
+	minDelta = XMLDocument::readAttribute<double>(elem, "mindelta", 0.0);
+	method = XMLDocument::readAttribute<int>(elem, "method", 7);
+	threads = XMLDocument::readAttribute<unsigned int>(elem, "threads", 1);
+	if (threads < 1)
+		throw cms::Exception("ProcMLP")
+			<< "Number of training threads has to be "
+			   "at least one." << std::endl;
+	if (threads > 1 && method != 1)
+		throw cms::Exception("ProcMLP")
+			<< "Training threads are only supported by the "
+			   "stochastic minimisation (method 1)." << std::endl;
+	batch = XMLDocument::readAttribute<int>(elem, "batch", 0);
+
+	std::string prec = XMLDocument::readAttribute<std::string>(
+						elem, "precision", "double");
+	if (prec == "double")
+		precision = MLP::PRECISION_DOUBLE;
+	else if (prec == "float-store")
+		precision = MLP::PRECISION_FLOAT_STORE;
+	else if (prec == "float")
+		precision = MLP::PRECISION_FLOAT;
+	else
+		throw cms::Exception("ProcMLP")
+			<< "Invalid precision \"" << prec << "\", "
+			   "expected \"double\", \"float-store\" or "
+			   "\"float\"." << std::endl;
+
+	std::string store = XMLDocument::readAttribute<std::string>(
+						elem, "store", "memory");
+	if (store == "memory")
+		fileStore = false;
+	else if (store == "file")
+		fileStore = true;
+	else
+		throw cms::Exception("ProcMLP")
+			<< "Invalid pattern store \"" << store << "\", "
+			   "expected \"memory\" or \"file\"." << std::endl;
+
+	std::string shuffle = XMLDocument::readAttribute<std::string>(
+						elem, "shuffle", "full");
+	if (shuffle == "full")
+		shuffleBlock = 0;
+	else if (shuffle == "block") {
+		// block size 0 = chosen from the cache size
+		shuffleBlock = XMLDocument::readAttribute<unsigned int>(
+						elem, "shuffleblock", 0);
+		if (!shuffleBlock)
+			shuffleBlock = -1;
+	} else
+		throw cms::Exception("ProcMLP")
+			<< "Invalid shuffle mode \"" << shuffle << "\", "
+			   "expected \"full\" or \"block\"." << std::endl;
+	reorder = XMLDocument::readAttribute<unsigned int>(elem, "reorder", 0);
+
+	// one variant per layout (separated by spaces or commas) and seed
+	std::vector<std::string> layouts = splitList(
+			(const char*)XMLSimpleStr(node->getTextContent()));
+	if (layouts.empty())
+		throw cms::Exception("ProcMLP")
+			<< "Expected MLP layout in config section."
+			<< std::endl;
+
+	std::vector<long> seeds;
+	std::vector<std::string> seedList = splitList(
+			XMLDocument::readAttribute<std::string>(
+						elem, "seeds", ""));
+	for(std::vector<std::string>::const_iterator iter =
+		seedList.begin(); iter != seedList.end(); ++iter) {
+		std::istringstream ss(*iter);
+		long seed = -1;
+		ss >> seed;
+		if (ss.fail() || seed < 0)
+			throw cms::Exception("ProcMLP")
+				<< "Invalid seed \"" << *iter << "\"."
+				<< std::endl;
+		seeds.push_back(seed);
+	}
+	if (seeds.empty())
+		seeds.push_back(-1);
+
+	variants.clear();
+	for(std::vector<std::string>::const_iterator iter = layouts.begin();
+	    iter != layouts.end(); ++iter) {
+		for(std::vector<long>::const_iterator seed = seeds.begin();
+		    seed != seeds.end(); ++seed) {
+			Variant variant;
+			variant.layout = *iter;
+			variant.seed = *seed;
+			variant.error = 0.0;
+			variant.ok = false;
+			variants.push_back(variant);
+		}
+	}
 
-	layout = (const char*)XMLSimpleStr(node->getTextContent());
+	// concurrent worker processes for several variants, 0 = one per
+	// CPU divided by the training threads of each
+	workers = XMLDocument::readAttribute<unsigned int>(elem, "workers", 1);
+
+	// reordering permutes the patterns in place, each worker would
+	// need its own copy of the store
+	if (shuffleBlock && reorder && workers != 1 && variants.size() > 1)
+		throw cms::Exception("ProcMLP")
+			<< "Pattern reordering cannot be used with several "
+			   "worker processes, set workers=\"1\" or "
+			   "reorder=\"0\"." << std::endl;
+
+	// keep a weighted random sample of at most this many events (or
+	// megabytes of patterns) per class, 0 = keep all
+	reservoirSize = XMLDocument::readAttribute<unsigned int>(
+						elem, "reservoir", 0);
+	reservoirMemory = XMLDocument::readAttribute<double>(
+						elem, "reservoirmem", 0.0);
+
+	// additionally write the weights in the mlpfit text format
+	textWeights = XMLDocument::readAttribute<bool>(elem, "textweights",
+	                                               false);
 
 	node = node->getNextSibling();
 	while(node && node->getNodeType() != DOMNode::ELEMENT_NODE)
@@ -129,16 +366,9 @@ void ProcMLP::configure(DOMElement *elem)
 
 bool ProcMLP::load()
 {
-	bool ok = false;
-	/* test for weights file */ {
-		std::ifstream in(trainer->trainFileName(this, "txt").c_str());
-		ok = in.good();
-	}
-
-	if (!ok)
+	if (!loadWeights(trainer->trainFileName(this, "bin")))
 		return false;
 
-//	mlp->load(trainer->trainFileName(this, "txt"));
 	iteration = ITER_DONE;
 	trained = true;
 	return true;
@@ -148,82 +378,172 @@ Calibration::VarProcessor *ProcMLP::getCalibration() const
 {
 	Calibration::ProcMLP *calib = new Calibration::ProcMLP;
 
-	std::auto_ptr<MLP> mlp(new MLP(getInputs().size() - (boost >= 0 ? 1 : 0),
-	                               getOutputs().size(), layout));
-	mlp->load(trainer->trainFileName(this, "txt"));
-
-	std::string fileName = trainer->trainFileName(this, "txt");
-	std::ifstream in(fileName.c_str(), std::ios::binary | std::ios::in);
-	if (!in.good())
-		throw cms::Exception("ProcMLP")
-			<< "Weights file " << fileName
-			<< "cannot be opened for reading." << std::endl;
-
-	char linebuf[128];
-	linebuf[127] = 0;
-	do
-		in.getline(linebuf, 127);
-	while(linebuf[0] == '#');
-
-	int layers = mlp->getLayers();
-	const int *neurons = mlp->getLayout();
-
-	for(int layer = 1; layer < layers; layer++) {
+	std::vector<double>::const_iterator weight = weights.begin();
+	for(unsigned int layer = 1; layer < neurons.size(); layer++) {
 		Calibration::ProcMLP::Layer layerConf;
 
-		for(int i = 0; i < neurons[layer]; i++) {
+		for(unsigned int i = 0; i < neurons[layer]; i++) {
 			Calibration::ProcMLP::Neuron neuron;
 
-			for(int j = 0; j <= neurons[layer - 1]; j++) {
-				in.getline(linebuf, 127);
-				std::istringstream ss(linebuf);
-				double weight;
-				ss >> weight;
+			neuron.first = *weight++;
+			neuron.second.assign(weight,
+			                     weight + neurons[layer - 1]);
+			weight += neurons[layer - 1];
 
-				if (j == 0)
-					neuron.first = weight;
-				else
-					neuron.second.push_back(weight);
-			}
 			layerConf.first.push_back(neuron);
 		}
-		layerConf.second = layer < layers - 1;
+		layerConf.second = layer < neurons.size() - 1;
 
 		calib->layers.push_back(layerConf);
 	}
 
-	in.close();
-
 	return calib;
 }
 
+// Binary weights file: "MLPW", format version, epoch, number of layers,
+// neurons per layer (all uint32_t), the weights (double) in the order
+// of MLP::getWeights() and the CRC-32 of everything before it.
+
+void ProcMLP::keepWeights()
+{
+	neurons.assign(mlp->getLayout(), mlp->getLayout() + mlp->getLayers());
+	mlp->getWeights(weights);
+	weightsEpoch = mlp->getEpoch();
+}
+
+void ProcMLP::saveWeights(const std::string &fileName) const
+{
+	std::vector<uint32_t> header;
+	header.push_back(1);
+	header.push_back(weightsEpoch);
+	header.push_back(neurons.size());
+	header.insert(header.end(), neurons.begin(), neurons.end());
+
+	std::string data("MLPW");
+	data.append(reinterpret_cast<const char*>(&header.front()),
+	            header.size() * sizeof(uint32_t));
+	data.append(reinterpret_cast<const char*>(&weights.front()),
+	            weights.size() * sizeof(double));
+	uint32_t crc = crc32(0, data.data(), data.size());
+	data.append(reinterpret_cast<const char*>(&crc), sizeof crc);
+
+	std::ofstream out(fileName.c_str(), std::ios::binary | std::ios::out);
+	out.write(data.data(), data.size());
+	out.close();
+	if (!out)
+		throw cms::Exception("ProcMLP")
+			<< "Weights file " << fileName
+			<< " cannot be written." << std::endl;
+}
+
+bool ProcMLP::loadWeights(const std::string &fileName)
+{
+	std::ifstream in(fileName.c_str(), std::ios::binary | std::ios::in);
+	if (!in.good())
+		return false;
+
+	std::string data((std::istreambuf_iterator<char>(in)),
+	                 std::istreambuf_iterator<char>());
+
+	uint32_t crc = 0, header[3] = { 0, 0, 0 };
+	std::size_t size = data.size() - sizeof crc;
+	if (data.size() >= 4 + sizeof header + sizeof crc) {
+		std::memcpy(header, data.data() + 4, sizeof header);
+		std::memcpy(&crc, data.data() + size, sizeof crc);
+	}
+
+	if (data.compare(0, 4, "MLPW") != 0 || header[0] != 1 ||
+	    crc != crc32(0, data.data(), size))
+		throw cms::Exception("ProcMLP")
+			<< "Weights file " << fileName
+			<< " is corrupt." << std::endl;
+
+	std::size_t offset = 4 + sizeof header;
+	std::vector<uint32_t> layout;
+	std::size_t nWeights = 0;
+	if (header[2] >= 2 &&
+	    header[2] <= (size - offset) / sizeof(uint32_t)) {
+		layout.resize(header[2]);
+		std::memcpy(&layout.front(), data.data() + offset,
+		            layout.size() * sizeof(uint32_t));
+		offset += layout.size() * sizeof(uint32_t);
+		for(unsigned int i = 1; i < layout.size(); i++)
+			nWeights += layout[i] * (layout[i - 1] + 1);
+	}
+
+	if (layout.size() < 2 || offset + nWeights * sizeof(double) != size)
+		throw cms::Exception("ProcMLP")
+			<< "Weights file " << fileName
+			<< " has an inconsistent size." << std::endl;
+
+	weights.resize(nWeights);
+	std::memcpy(&weights.front(), data.data() + offset,
+	            nWeights * sizeof(double));
+	neurons = layout;
+	weightsEpoch = header[1];
+
+	return true;
+}
+
+// text export, in the format of the mlpfit SaveWeights()
+void ProcMLP::exportWeights(const std::string &fileName) const
+{
+	std::FILE *file = std::fopen(fileName.c_str(), "w");
+	if (!file)
+		throw cms::Exception("ProcMLP")
+			<< "Weights file " << fileName
+			<< " cannot be opened for writing." << std::endl;
+
+	std::fprintf(file, "# network structure ");
+	for(unsigned int i = 0; i < neurons.size(); i++)
+		std::fprintf(file, "%u ", neurons[i]);
+	std::fprintf(file, "\n %u\n", weightsEpoch);
+	for(unsigned int i = 0; i < weights.size(); i++)
+		std::fprintf(file, " %1.15e\n", weights[i]);
+
+	std::fclose(file);
+}
+
 void ProcMLP::trainBegin()
 {
 	rand.SetSeed(65539);
-	switch(iteration) {
-	    case ITER_COUNT:
-		count = 0;
-		weightSum = 0.0;
-		break;
-	    case ITER_TRAIN:
-		try {
-			mlp = std::auto_ptr<MLP>(
-					new MLP(getInputs().size() - (boost >= 0 ? 1 : 0),
-					getOutputs().size(), layout));
-			mlp->init(count);
-			row = 0;
-		} catch(cms::Exception e) {
-			// MLP probably busy (or layout invalid, aaaack)
-			iteration = ITER_WAIT;
-		}
-		break;
-	    default:
-		/* shut up */;
+	if (iteration != ITER_TRAIN)
+		return;
+
+	std::string file, validationFile;
+	if (fileStore) {
+		file = trainer->trainFileName(this, "pat");
+		validationFile = trainer->trainFileName(this, "pat",
+		                                        "validation");
+	}
+
+	patterns = std::auto_ptr<MLPPatternStore>(
+		new MLPPatternStore(vars.size(), targets.size(),
+		                    precision != MLP::PRECISION_DOUBLE, file));
+	validation = std::auto_ptr<MLPPatternStore>(
+		new MLPPatternStore(vars.size(), targets.size(),
+		                    precision != MLP::PRECISION_DOUBLE,
+		                    validationFile));
+	weightSum = 0.0;
+	validationWeightSum = 0.0;
+
+	unsigned int size = reservoirSize;
+	if (reservoirMemory > 0.0) {
+		std::size_t bytes = (targets.size() + 1) * sizeof(double) +
+		                    (vars.size() + 1) *
+		                    (precision != MLP::PRECISION_DOUBLE
+		                     	? sizeof(float) : sizeof(double));
+		unsigned int n = std::max(2.0, reservoirMemory *
+		                               1048576.0 / bytes);
+		size = size ? std::min(size, n) : n;
 	}
+	for(unsigned int i = 0; i < 4; i++)
+		reservoirs[i].reset(size ? new Reservoir(size, 65539 + i)
+		                         : 0);
 }
 
-void ProcMLP::trainData(const std::vector<double> *values,
-                        bool target, double weight)
+double ProcMLP::boostWeight(const std::vector<double> *values,
+                            bool target, double weight) const
 {
 	if (boost >= 0) {
 		double x = values[boost][0];
@@ -233,63 +553,451 @@ void ProcMLP::trainData(const std::vector<double> *values,
 			weight *= 1.0 + 0.1 * std::exp(5.0 * x);
 	}
 
+	return weight;
+}
+
+void ProcMLP::fillPattern(const std::vector<double> *values, bool target)
+{
+	for(unsigned int i = 0; i < vars.size(); i++, values++) {
+		if ((int)i == boost)
+			values++;
+		vars[i] = values->front();
+	}
+
+	for(unsigned int i = 0; i < targets.size(); i++)
+		targets[i] = target;
+}
+
+void ProcMLP::trainData(const std::vector<double> *values,
+                        bool target, double weight)
+{
+	weight = boostWeight(values, target, weight);
+
 	if (weight < limiter) {
 		if (rand.Uniform(limiter) > weight)
 			return;
 		weight = limiter;
 	}
 
-	if (iteration == ITER_COUNT)
-		count++;
-		weightSum += weight;
-
 	if (iteration != ITER_TRAIN)
 		return;
 
-	for(unsigned int i = 0; i < vars.size(); i++, values++) {
-		if ((int)i == boost)
-			values++;
-		vars[i] = values->front();
+	weightSum += weight;
+
+	fillPattern(values, target);
+	storePattern(*patterns, reservoirs[target ? 0 : 1].get(), weight);
+}
+
+void ProcMLP::testData(const std::vector<double> *values,
+                       bool target, double weight, bool trainedOn)
+{
+	// events held out from training are used for validation
+	if (iteration != ITER_TRAIN || trainedOn)
+		return;
+
+	weight = boostWeight(values, target, weight);
+	validationWeightSum += weight;
+
+	fillPattern(values, target);
+	storePattern(*validation, reservoirs[target ? 2 : 3].get(), weight);
+}
+
+void ProcMLP::storePattern(MLPPatternStore &store, Reservoir *reservoir,
+                           double weight)
+{
+	if (!reservoir) {
+		store.add(&vars.front(), &targets.front(), weight);
+		return;
 	}
 
-	for(unsigned int i = 0; i < targets.size(); i++)
-		targets[i] = target;
+	int slot = reservoir->sampler.offer(weight);
+	if (slot < 0)
+		return;
 
-	mlp->set(row++, &vars.front(), &targets.front(), weight);
+	if ((unsigned int)slot < reservoir->patterns.size())
+		store.set(reservoir->patterns[slot],
+		          &vars.front(), &targets.front(), weight);
+	else {
+		reservoir->patterns.push_back(store.size());
+		store.add(&vars.front(), &targets.front(), weight);
+	}
+}
+
+// the sampled patterns get the reweighted weights of the reservoirs
+void ProcMLP::finishReservoirs()
+{
+	static const char *const names[4] = {
+		"signal", "background",
+		"validation signal", "validation background"
+	};
+
+	for(unsigned int i = 0; i < 4; i++) {
+		Reservoir *reservoir = reservoirs[i].get();
+		if (!reservoir)
+			continue;
+
+		MLPPatternStore &store = i < 2 ? *patterns : *validation;
+		double &sum = i < 2 ? weightSum : validationWeightSum;
+
+		const ReservoirSampler &sampler = reservoir->sampler;
+		sum -= sampler.getOfferedWeight();
+		for(unsigned int j = 0; j < sampler.size(); j++) {
+			double weight = sampler.getWeight(j);
+			store.setWeight(reservoir->patterns[j], weight);
+			sum += weight;
+		}
+
+		std::cout << "Reservoir sampling kept " << sampler.size()
+		          << " of " << sampler.getOffered() << " "
+		          << names[i] << " events." << std::endl;
+
+		reservoirs[i].reset();
+	}
+}
+
+static double wallClock()
+{
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return tv.tv_sec + 1.0e-6 * tv.tv_usec;
+}
+
+static double cpuClock()
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) < 0)
+		return 0.0;
+	return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+	       1.0e-6 * (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
 }
 
-void ProcMLP::runMLPTrainer()
+double ProcMLP::runMLPTrainer(const std::string &weightsFile,
+                              const std::string &label)
 {
+	bool validate = validation->size() > 0;
+	bool earlyStop = validate && patience > 0;
+	bool budget = wallLimit >= 0.0 || cpuLimit >= 0.0;
+
+	double wallStart = wallClock(), cpuStart = cpuClock();
+	double wallEpoch = 0.0, cpuEpoch = 0.0;
+
+	double best = 0.0, error = 0.0, valError = 0.0;
+	unsigned int bestEpoch = 0, bad = 0;
 	for(unsigned int i = 0; i < steps; i++) {
-		double error = mlp->train();
+		// stop if the next epoch, estimated by the slowest one so
+		// far (with some margin), would not fit in the time budget
+		if (budget && i > 0) {
+			double wall = wallClock() - wallStart;
+			double cpu = cpuClock() - cpuStart;
+			if ((wallLimit >= 0.0 &&
+			     wall + 1.2 * wallEpoch > wallLimit) ||
+			    (cpuLimit >= 0.0 &&
+			     cpu + 1.2 * cpuEpoch > cpuLimit)) {
+				std::cout << label << "Stopping MLP training "
+				             "after epoch " << mlp->getEpoch()
+				          << ", time budget used up ("
+				          << wall << " s, " << cpu
+				          << " s CPU)" << std::endl;
+				break;
+			}
+		}
+
+		double wall = wallClock(), cpu = cpuClock();
+
+		error = mlp->train() / weightSum;
+
+		if (!validate) {
+			if ((i % 10) == 0) {
+				std::cout << label << "Training MLP epoch "
+				          << mlp->getEpoch()
+				          << ", rel chi^2: "
+				          << error << std::endl;
+
+				// usable weights in case we get killed
+				if (budget) {
+					keepWeights();
+					saveWeights(weightsFile);
+				}
+			}
+			wallEpoch = std::max(wallEpoch, wallClock() - wall);
+			cpuEpoch = std::max(cpuEpoch, cpuClock() - cpu);
+			continue;
+		}
+
+		valError = mlp->test() / validationWeightSum;
+		wallEpoch = std::max(wallEpoch, wallClock() - wall);
+		cpuEpoch = std::max(cpuEpoch, cpuClock() - cpu);
 		if ((i % 10) == 0)
-			std::cout << "Training MLP epoch " << mlp->getEpoch()
-			          << ", rel chi^2: " << (error / weightSum)
+			std::cout << label << "Training MLP epoch "
+			          << mlp->getEpoch()
+			          << ", rel chi^2: " << error
+			          << ", validation: " << valError
 			          << std::endl;
+
+		if (!earlyStop) {
+			// usable weights in case we get killed
+			if (budget && (i % 10) == 0) {
+				keepWeights();
+				saveWeights(weightsFile);
+			}
+			continue;
+		}
+
+		// keep the weights of the best epoch seen so far
+		if (!bestEpoch || valError < best * (1.0 - minDelta)) {
+			best = valError;
+			bestEpoch = mlp->getEpoch();
+			bad = 0;
+			keepWeights();
+			if (budget)
+				saveWeights(weightsFile);
+		} else if (++bad >= patience) {
+			std::cout << label << "Stopping MLP training after "
+			             "epoch " << mlp->getEpoch()
+			          << ", no improvement since epoch "
+			          << bestEpoch << " (validation rel chi^2: "
+			          << best << ")" << std::endl;
+			break;
+		}
 	}
+
+	if (!earlyStop)
+		keepWeights();
+	saveWeights(weightsFile);
+
+	return earlyStop ? best : validate ? valError : error;
 }
 
-void ProcMLP::trainEnd()
+// trains one variant in this process, returns its (validation) error
+double ProcMLP::trainVariant(unsigned int index,
+                             const std::string &weightsFile,
+                             const std::string &label)
+{
+	const Variant &variant = variants[index];
+
+	// the initial weights are drawn with random()
+	if (variant.seed >= 0)
+		srandom(variant.seed);
+
+	mlp = std::auto_ptr<MLP>(
+			new MLP(getInputs().size() - (boost >= 0 ? 1 : 0),
+			getOutputs().size(), variant.layout, method));
+	mlp->setThreads(threads);
+	mlp->setBatch(batch);
+	mlp->setPrecision(precision);
+	mlp->setShuffle(shuffleBlock, reorder);
+	mlp->init(*patterns);
+	if (validation->size() > 0)
+		mlp->setValidation(*validation);
+
+	double error = runMLPTrainer(weightsFile, label);
+	mlp->clear();
+	mlp.reset();
+
+	return error;
+}
+
+std::string ProcMLP::variantLabel(unsigned int index) const
 {
-	switch(iteration) {
-	    case ITER_COUNT:
-	    case ITER_WAIT:
-		iteration = ITER_TRAIN;
-		std::cout << "Training with " << count << " events. "
-		              "(weighted " << weightSum << ")" << std::endl;
-		break;
-	    case ITER_TRAIN:
-		runMLPTrainer();
-		mlp->save(trainer->trainFileName(this, "txt"));
-		mlp->clear();
-		mlp.reset();
-		needCleanup = true;
-		iteration = ITER_DONE;
-		trained = true;
-		break;
-	    default:
-		/* shut up */;
+	std::ostringstream ss;
+	ss << "MLP variant " << (index + 1) << " ("
+	   << variants[index].layout;
+	if (variants[index].seed >= 0)
+		ss << ", seed " << variants[index].seed;
+	ss << "): ";
+	return ss.str();
+}
+
+// forked worker: trains one variant on the pattern memory inherited
+// from the parent and reports its error through the pipe fd
+void ProcMLP::runWorker(unsigned int index, int fd)
+{
+	int status = 1;
+	try {
+		patterns->makePrivate();
+		validation->makePrivate();
+
+		std::ostringstream arg;
+		arg << "variant" << index;
+		double error = trainVariant(index,
+			trainer->trainFileName(this, "bin", arg.str()),
+			variantLabel(index));
+		if (write(fd, &error, sizeof error) == sizeof error)
+			status = 0;
+	} catch(const cms::Exception &e) {
+		std::cerr << variantLabel(index) << e.what() << std::endl;
+	} catch(const std::exception &e) {
+		std::cerr << variantLabel(index) << e.what() << std::endl;
+	} catch(...) {
+		std::cerr << variantLabel(index) << "unknown exception."
+		          << std::endl;
+	}
+
+	// no destructors or exit handlers of the parent's objects
+	std::cout.flush();
+	std::cerr.flush();
+	std::fflush(0);
+	_exit(status);
+}
+
+// trains all variants in worker processes sharing the pattern store
+// (copy-on-write), keeps the one with the smallest error
+void ProcMLP::trainEnsemble()
+{
+	unsigned int n = variants.size();
+	unsigned int nWorkers = workers;
+	if (!nWorkers) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		nWorkers = cpus > 0 ? (unsigned int)cpus / threads : 1;
+		nWorkers = std::max(nWorkers, 1u);
 	}
+	nWorkers = std::min(nWorkers, n);
+
+	// the variants run in rounds of nWorkers, each takes its CPU time
+	unsigned int rounds = (n + nWorkers - 1) / nWorkers;
+	if (wallLimit >= 0.0)
+		wallLimit /= rounds;
+	if (cpuLimit >= 0.0)
+		cpuLimit /= n;
+
+	std::cout << "Training " << n << " MLP variants in up to "
+	          << nWorkers << " worker processes." << std::endl;
+
+	std::map<pid_t, unsigned int> running;
+	std::vector<int> pipes(n, -1);
+	unsigned int next = 0;
+	while(next < n || !running.empty()) {
+		if (next < n && running.size() < nWorkers) {
+			int fd[2];
+			if (pipe(fd) < 0)
+				throw cms::Exception("ProcMLP")
+					<< "Cannot create pipe: "
+					<< std::strerror(errno) << std::endl;
+
+			// buffered output would be written twice
+			std::cout.flush();
+			std::cerr.flush();
+			std::fflush(0);
+
+			pid_t pid = fork();
+			if (pid < 0)
+				throw cms::Exception("ProcMLP")
+					<< "Cannot fork worker process: "
+					<< std::strerror(errno) << std::endl;
+			if (pid == 0) {
+				close(fd[0]);
+				runWorker(next, fd[1]);
+			}
+
+			close(fd[1]);
+			pipes[next] = fd[0];
+			running[pid] = next++;
+			continue;
+		}
+
+		int status;
+		pid_t pid = waitpid(-1, &status, 0);
+		if (pid < 0) {
+			if (errno == EINTR)
+				continue;
+			throw cms::Exception("ProcMLP")
+				<< "Waiting for worker processes failed: "
+				<< std::strerror(errno) << std::endl;
+		}
+
+		std::map<pid_t, unsigned int>::iterator pos =
+							running.find(pid);
+		if (pos == running.end())
+			continue;
+
+		Variant &variant = variants[pos->second];
+		variant.ok = WIFEXITED(status) && !WEXITSTATUS(status) &&
+		             read(pipes[pos->second], &variant.error,
+		                  sizeof variant.error) ==
+		             sizeof variant.error;
+		close(pipes[pos->second]);
+		running.erase(pos);
+	}
+
+	const char *what = validation->size() > 0 ? "validation" : "training";
+	int best = -1;
+	for(unsigned int i = 0; i < n; i++) {
+		std::cout << variantLabel(i);
+		if (variants[i].ok)
+			std::cout << what << " rel chi^2 "
+			          << variants[i].error << std::endl;
+		else
+			std::cout << "failed" << std::endl;
+
+		if (variants[i].ok &&
+		    (best < 0 || variants[i].error < variants[best].error))
+			best = i;
+	}
+
+	if (best < 0)
+		throw cms::Exception("ProcMLP")
+			<< "Training failed for all MLP variants."
+			<< std::endl;
+
+	std::cout << "Using MLP variant " << (best + 1) << "." << std::endl;
+
+	std::string weightsFile = trainer->trainFileName(this, "bin");
+	for(unsigned int i = 0; i < n; i++) {
+		std::ostringstream arg;
+		arg << "variant" << i;
+		std::string file = trainer->trainFileName(this, "bin",
+		                                          arg.str());
+		if ((int)i != best)
+			std::remove(file.c_str());
+		else if (std::rename(file.c_str(), weightsFile.c_str()) < 0)
+			throw cms::Exception("ProcMLP")
+				<< "Cannot rename \"" << file << "\" to \""
+				<< weightsFile << "\": "
+				<< std::strerror(errno) << std::endl;
+	}
+
+	if (!loadWeights(weightsFile))
+		throw cms::Exception("ProcMLP")
+			<< "Weights file " << weightsFile
+			<< " cannot be opened for reading." << std::endl;
+}
+
+void ProcMLP::trainEnd()
+{
+	if (iteration != ITER_TRAIN)
+		return;
+
+	finishReservoirs();
+
+	std::cout << "Training with " << patterns->size() << " events. "
+	             "(weighted " << weightSum << ")" << std::endl;
+	if (validation->size() > 0)
+		std::cout << "Validating with " << validation->size()
+		          << " events. (weighted " << validationWeightSum
+		          << ")" << std::endl;
+
+	wallLimit = trainer->getTimeLeft(this);
+	cpuLimit = trainer->getTimeLeft(this, true);
+	if (wallLimit >= 0.0)
+		std::cout << "Time budget left for training: "
+		          << wallLimit << " s" << std::endl;
+	if (cpuLimit >= 0.0)
+		std::cout << "CPU time budget left for training: "
+		          << cpuLimit << " s" << std::endl;
+
+	if (variants.size() > 1)
+		trainEnsemble();
+	else
+		trainVariant(0, trainer->trainFileName(this, "bin"), "");
+
+	if (textWeights)
+		exportWeights(trainer->trainFileName(this, "txt"));
+
+	patterns.reset();
+	validation.reset();
+	needCleanup = true;
+	iteration = ITER_DONE;
+	trained = true;
 }
 
 void ProcMLP::cleanup()
@@ -297,7 +1005,7 @@ void ProcMLP::cleanup()
 	if (!needCleanup)
 		return;
 
-	std::remove(trainer->trainFileName(this, "txt").c_str());
+	std::remove(trainer->trainFileName(this, "bin").c_str());
 }
 
 MVA_TRAINER_DEFINE_PLUGIN(ProcMLP);
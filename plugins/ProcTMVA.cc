@@ -1,4 +1,7 @@
 #include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include <algorithm>
 #include <iostream>
 #include <sstream>
@@ -6,7 +9,9 @@
 #include <cstddef>
 #include <cstring>
 #include <cstdio>
+#include <cerrno>
 #include <vector>
+#include <map>
 #include <memory>
 
 #include <xercesc/dom/DOM.hpp>
@@ -28,8 +33,10 @@
 #include "PhysicsTools/MVATrainer/interface/XMLDocument.h"
 #include "PhysicsTools/MVATrainer/interface/XMLSimpleStr.h"
 #include "PhysicsTools/MVATrainer/interface/MVATrainer.h"
+#include "PhysicsTools/MVATrainer/interface/ReservoirSampler.h"
 #include "PhysicsTools/MVATrainer/interface/SourceVariable.h"
 #include "PhysicsTools/MVATrainer/interface/TrainProcessor.h"
+#include "PhysicsTools/MVATrainer/interface/TreeExportOptions.h"
 
 XERCES_CPP_NAMESPACE_USE
 
@@ -67,14 +74,25 @@ class ProcTMVA : public TrainProcessor {
 	virtual void cleanup();
 
     private:
-	void runTMVATrainer();
-
 	struct Method {
 		TMVA::Types::EMVA	type;
 		std::string		name;
 		std::string		description;
 	};
 
+	void runTMVATrainer();
+	void trainMethods(std::vector<Method>::const_iterator begin,
+	                  std::vector<Method>::const_iterator end,
+	                  const std::string &output) const;
+	void trainParallel(unsigned int begin, unsigned int end,
+	                   unsigned int nWorkers) const;
+	unsigned int affordableMethods(double wallCost, double cpuCost,
+	                               unsigned int nWorkers) const;
+	void runWorker(unsigned int index) const;
+	void fillSamples();
+	void fill(TTree *tree);
+	void exportInput() const;
+
 	std::string getTreeName() const
 	{ return trainer->getName() + '_' + (const char*)getName(); }
 
@@ -91,16 +109,23 @@ class ProcTMVA : public TrainProcessor {
 
 	std::vector<Method>		methods;
 	std::vector<std::string>	names;
-	std::auto_ptr<TFile>		file;
 	TTree				*treeSig, *treeBkg;
 	Double_t			weight;
 	std::vector<Double_t>		vars;
+	std::vector<Float_t>		floatVars;	// with float storage
+	TreeExportOptions		options;
 	bool				needCleanup;
+	bool				doExportInput;	// also write the input trees to a file
+	unsigned int			workers;	// concurrent methods, 0: one per CPU
 	unsigned long			nSignal;
 	unsigned long			nBackground;
 	bool				doUserTreeSetup;
 	std::string			setupCuts;	// cut applied by TMVA to signal and background trees
 	std::string			setupOptions;	// training/test tree TMVA setup options
+	unsigned int			reservoirSize;	// events per class, 0: keep all
+	double				reservoirMemory;	// MB per class
+	std::auto_ptr<ReservoirSampler>	reservoirs[2];	// signal, background
+	std::vector<Double_t>		samples[2];	// vars of the sampled events
 };
 
 static ProcTMVA::Registry registry("ProcTMVA");
@@ -109,7 +134,9 @@ ProcTMVA::ProcTMVA(const char *name, const AtomicId *id,
                    MVATrainer *trainer) :
 	TrainProcessor(name, id, trainer),
 	iteration(ITER_EXPORT), treeSig(0), treeBkg(0), needCleanup(false),
-	doUserTreeSetup(false), setupOptions("SplitMode = Block:!V")
+	doExportInput(false), workers(0),
+	doUserTreeSetup(false), setupOptions("SplitMode = Block:!V"),
+	reservoirSize(0), reservoirMemory(0.0)
 {
 }
 
@@ -141,6 +168,14 @@ void ProcTMVA::configure(DOMElement *elem)
 		names.push_back(name);
 	}
 
+	// the input trees are kept in memory, on disk only for debugging
+	doExportInput = XMLDocument::readAttribute<bool>(
+					elem, "exportinput", false);
+
+	// several methods are trained in parallel worker processes
+	workers = XMLDocument::readAttribute<unsigned int>(
+					elem, "workers", 0);
+
 	for(DOMNode *node = elem->getFirstChild();
 	    node; node = node->getNextSibling()) {
 		if (node->getNodeType() != DOMNode::ELEMENT_NODE)
@@ -148,10 +183,13 @@ void ProcTMVA::configure(DOMElement *elem)
 
 		bool isMethod = !std::strcmp(XMLSimpleStr(node->getNodeName()), "method");
 		bool isSetup  = !std::strcmp(XMLSimpleStr(node->getNodeName()), "setup");
+		bool isReservoir = !std::strcmp(XMLSimpleStr(node->getNodeName()), "reservoir");
+		bool isExport = !std::strcmp(XMLSimpleStr(node->getNodeName()), "export");
 
-		if (!isMethod && !isSetup)
+		if (!isMethod && !isSetup && !isReservoir && !isExport)
 			throw cms::Exception("ProcTMVA")
-				<< "Expected method or setup tag in config section."
+				<< "Expected method, setup, reservoir or "
+				   "export tag in config section."
 				<< std::endl;
 
 		elem = static_cast<DOMElement*>(node);
@@ -185,7 +223,17 @@ void ProcTMVA::configure(DOMElement *elem)
 			setupOptions =
 				XMLDocument::readAttribute<std::string>(
 							elem, "options");
-		}
+		} else if (isReservoir) {
+			// weighted random sample of at most this many
+			// events (or megabytes) per class
+			reservoirSize =
+				XMLDocument::readAttribute<unsigned int>(
+							elem, "events", 0);
+			reservoirMemory =
+				XMLDocument::readAttribute<double>(
+							elem, "memory", 0.0);
+		} else if (isExport)
+			options.configure(elem);
 	}
 
 	if (!methods.size())
@@ -268,38 +316,49 @@ Calibration::VarProcessor *ProcTMVA::getCalibration() const
 void ProcTMVA::trainBegin()
 {
 	if (iteration == ITER_EXPORT) {
-		ROOTContextSentinel ctx;
-
-		file = std::auto_ptr<TFile>(TFile::Open(
-			trainer->trainFileName(this, "root",
-			                       "input").c_str(),
-			"RECREATE"));
-		if (!file.get())
-			throw cms::Exception("ProcTMVA")
-				<< "Could not open ROOT file for writing."
-				<< std::endl;
-
-		file->cd();
 		treeSig = new TTree((getTreeName() + "_sig").c_str(),
 		                    "MVATrainer signal");
 		treeBkg = new TTree((getTreeName() + "_bkg").c_str(),
 		                    "MVATrainer background");
 
-		treeSig->Branch("__WEIGHT__", &weight, "__WEIGHT__/D");
-		treeBkg->Branch("__WEIGHT__", &weight, "__WEIGHT__/D");
+		// memory resident, handed to TMVA directly
+		treeSig->SetDirectory(0);
+		treeBkg->SetDirectory(0);
+		options.apply(treeSig);
+		options.apply(treeBkg);
 
-		vars.resize(names.size());
+		Int_t basketSize = options.getBasketSize();
+		treeSig->Branch("__WEIGHT__", &weight, "__WEIGHT__/D",
+		                basketSize);
+		treeBkg->Branch("__WEIGHT__", &weight, "__WEIGHT__/D",
+		                basketSize);
 
-		std::vector<Double_t>::iterator pos = vars.begin();
-		for(std::vector<std::string>::const_iterator iter =
-			names.begin(); iter != names.end(); iter++, pos++) {
-			treeSig->Branch(iter->c_str(), &*pos,
-			                (*iter + "/D").c_str());
-			treeBkg->Branch(iter->c_str(), &*pos,
-			                (*iter + "/D").c_str());
+		vars.resize(names.size());
+		floatVars.resize(options.useFloat() ? names.size() : 0);
+
+		for(unsigned int i = 0; i < names.size(); i++) {
+			void *addr = options.useFloat()
+			             ? (void*)&floatVars[i] : (void*)&vars[i];
+			std::string leaf = names[i] + '/' + options.getType();
+			treeSig->Branch(names[i].c_str(), addr, leaf.c_str(),
+			                basketSize);
+			treeBkg->Branch(names[i].c_str(), addr, leaf.c_str(),
+			                basketSize);
 		}
 
 		nSignal = nBackground = 0;
+
+		unsigned int size = reservoirSize;
+		if (reservoirMemory > 0.0) {
+			unsigned int n = std::max(2.0, reservoirMemory *
+				1048576.0 / (vars.size() * sizeof(Double_t)));
+			size = size ? std::min(size, n) : n;
+		}
+		for(unsigned int i = 0; i < 2; i++) {
+			reservoirs[i].reset(size ? new ReservoirSampler(
+						size, 65539 + i) : 0);
+			samples[i].clear();
+		}
 	}
 }
 
@@ -313,28 +372,99 @@ void ProcTMVA::trainData(const std::vector<double> *values,
 	for(unsigned int i = 0; i < vars.size(); i++, values++)
 		vars[i] = values->front();
 
+	// sampled events are written to the trees at the end
+	if (reservoirs[0].get()) {
+		std::vector<Double_t> &sample = samples[target ? 0 : 1];
+		int slot = reservoirs[target ? 0 : 1]->offer(weight);
+		if (slot < 0)
+			return;
+
+		std::size_t offset = (std::size_t)slot * vars.size();
+		if (offset >= sample.size())
+			sample.resize(offset + vars.size());
+		std::copy(vars.begin(), vars.end(), sample.begin() + offset);
+		return;
+	}
+
 	if (target) {
-		treeSig->Fill();
+		fill(treeSig);
 		nSignal++;
 	} else {
-		treeBkg->Fill();
+		fill(treeBkg);
 		nBackground++;
 	}
 }
 
-void ProcTMVA::runTMVATrainer()
+void ProcTMVA::fill(TTree *tree)
 {
-	needCleanup = true;
+	std::copy(vars.begin(), vars.begin() + floatVars.size(),
+	          floatVars.begin());
+	tree->Fill();
+}
 
-	if (nSignal < 1 || nBackground < 1)
-		throw cms::Exception("ProcTMVA")
-			<< "Not going to run TMVA: "
-			   "No signal (" << nSignal << ") or background ("
-			<< nBackground << ") events!" << std::endl;
+// fills the trees with the sampled events and their new weights
+void ProcTMVA::fillSamples()
+{
+	for(unsigned int i = 0; i < 2; i++) {
+		const ReservoirSampler *reservoir = reservoirs[i].get();
+		if (!reservoir)
+			continue;
+
+		TTree *tree = i ? treeBkg : treeSig;
+		unsigned long &count = i ? nBackground : nSignal;
+		for(unsigned int j = 0; j < reservoir->size(); j++) {
+			weight = reservoir->getWeight(j);
+			if (weight == 0.0)
+				continue;
+
+			std::copy(samples[i].begin() + j * vars.size(),
+			          samples[i].begin() + (j + 1) * vars.size(),
+			          vars.begin());
+			fill(tree);
+			count++;
+		}
+
+		printf("Reservoir sampling kept %lu of %lu %s events\n",
+		       count, reservoir->getOffered(),
+		       i ? "background" : "signal");
+
+		reservoirs[i].reset();
+		std::vector<Double_t>().swap(samples[i]);
+	}
+}
 
+// debugging copy of the input trees
+void ProcTMVA::exportInput() const
+{
 	std::auto_ptr<TFile> file(TFile::Open(
-		trainer->trainFileName(this, "root", "output").c_str(),
+		trainer->trainFileName(this, "root", "input").c_str(),
 		"RECREATE"));
+	if (!file.get())
+		throw cms::Exception("ProcTMVA")
+			<< "Could not open ROOT file for writing."
+			<< std::endl;
+
+	// copied, to be stored with the export settings
+	options.apply(file.get());
+	file->cd();
+	treeSig->CloneTree(-1)->Write();
+	treeBkg->CloneTree(-1)->Write();
+	file->Close();
+}
+
+static double fileSize(const std::string &fileName)
+{
+	struct stat st;
+	return stat(fileName.c_str(), &st) < 0 ? 0.0 : (double)st.st_size;
+}
+
+// books the methods [begin, end) in one TMVA factory writing into the
+// given output file, trains, tests and evaluates them
+void ProcTMVA::trainMethods(std::vector<Method>::const_iterator begin,
+                            std::vector<Method>::const_iterator end,
+                            const std::string &output) const
+{
+	std::auto_ptr<TFile> file(TFile::Open(output.c_str(), "RECREATE"));
 	if (!file.get())
 		throw cms::Exception("ProcTMVA")
 			<< "Could not open TMVA ROOT file for writing."
@@ -347,7 +477,7 @@ void ProcTMVA::runTMVATrainer()
 
 	for(std::vector<std::string>::const_iterator iter = names.begin();
 	    iter != names.end(); iter++)
-		factory->AddVariable(iter->c_str(), 'D');
+		factory->AddVariable(iter->c_str(), options.getType());
 
 	factory->SetWeightExpression("__WEIGHT__");
 
@@ -359,8 +489,8 @@ void ProcTMVA::runTMVATrainer()
 				"", 0, 0, 0, 0,
 				"SplitMode=Block:!V");
 
-	for(std::vector<Method>::const_iterator iter = methods.begin();
-	    iter != methods.end(); ++iter)
+	for(std::vector<Method>::const_iterator iter = begin;
+	    iter != end; ++iter)
 		factory->BookMethod(iter->type, iter->name, iter->description);
 
 	factory->TrainAllMethods();
@@ -370,8 +500,177 @@ void ProcTMVA::runTMVATrainer()
 	factory.release(); // ROOT seems to take care of destruction?!
 
 	file->Close();
+}
+
+// forked worker: trains one method on the trees inherited from the parent
+void ProcTMVA::runWorker(unsigned int index) const
+{
+	int status = 1;
+	try {
+		const Method &method = methods[index];
+		trainMethods(methods.begin() + index,
+		             methods.begin() + index + 1,
+		             trainer->trainFileName(this, "root",
+		                                    "output_" + method.name));
+		status = 0;
+	} catch(const cms::Exception &e) {
+		std::cerr << "TMVA method " << methods[index].name << ": "
+		          << e.what() << std::endl;
+	} catch(const std::exception &e) {
+		std::cerr << "TMVA method " << methods[index].name << ": "
+		          << e.what() << std::endl;
+	} catch(...) {
+		std::cerr << "TMVA method " << methods[index].name << ": "
+		             "unknown exception." << std::endl;
+	}
+
+	// no destructors or exit handlers of the parent's objects
+	std::cout.flush();
+	std::cerr.flush();
+	std::fflush(0);
+	_exit(status);
+}
+
+// trains the methods [begin, end) in up to nWorkers concurrent processes,
+// each with its own factory, the weights files all end up in weights/
+void ProcTMVA::trainParallel(unsigned int begin, unsigned int end,
+                             unsigned int nWorkers) const
+{
+	printf("Training %u TMVA methods in up to %u worker processes\n",
+	       end - begin, nWorkers);
+
+	std::map<pid_t, unsigned int> running;
+	std::vector<bool> ok(end, false);
+	unsigned int next = begin;
+	while(next < end || !running.empty()) {
+		if (next < end && running.size() < nWorkers) {
+			// buffered output would be written twice
+			std::cout.flush();
+			std::cerr.flush();
+			std::fflush(0);
+
+			pid_t pid = fork();
+			if (pid < 0)
+				throw cms::Exception("ProcTMVA")
+					<< "Cannot fork worker process: "
+					<< std::strerror(errno) << std::endl;
+			if (pid == 0)
+				runWorker(next);
+
+			running[pid] = next++;
+			continue;
+		}
+
+		int status;
+		pid_t pid = waitpid(-1, &status, 0);
+		if (pid < 0) {
+			if (errno == EINTR)
+				continue;
+			throw cms::Exception("ProcTMVA")
+				<< "Waiting for worker processes failed: "
+				<< std::strerror(errno) << std::endl;
+		}
+
+		std::map<pid_t, unsigned int>::iterator pos =
+							running.find(pid);
+		if (pos == running.end())
+			continue;
+
+		ok[pos->second] = WIFEXITED(status) && !WEXITSTATUS(status);
+		running.erase(pos);
+	}
+
+	// only the first method is needed for the calibration
+	for(unsigned int i = std::max(begin, 1u); i < end; i++)
+		if (!ok[i])
+			printf("Training of TMVA method %s failed\n",
+			       methods[i].name.c_str());
+	if (begin == 0 && !ok[0])
+		throw cms::Exception("ProcTMVA")
+			<< "Training of TMVA method " << methods[0].name
+			<< " failed." << std::endl;
+}
+
+// number of the additional methods that fit into the time left, each
+// estimated to cost as much as the first one, run nWorkers at a time
+unsigned int ProcTMVA::affordableMethods(double wallCost, double cpuCost,
+                                         unsigned int nWorkers) const
+{
+	double timeLeft = trainer->getTimeLeft(this);
+	double cpuLeft = trainer->getTimeLeft(this, true);
+
+	unsigned int m = methods.size() - 1;
+	while(m > 0) {
+		unsigned int rounds = (m + nWorkers - 1) / nWorkers;
+		if ((timeLeft < 0.0 || rounds * wallCost <= timeLeft) &&
+		    (cpuLeft < 0.0 || m * cpuCost <= cpuLeft))
+			break;
+		m--;
+	}
+	return m;
+}
+
+void ProcTMVA::runTMVATrainer()
+{
+	needCleanup = true;
+
+	if (nSignal < 1 || nBackground < 1)
+		throw cms::Exception("ProcTMVA")
+			<< "Not going to run TMVA: "
+			   "No signal (" << nSignal << ") or background ("
+			<< nBackground << ") events!" << std::endl;
+
+	unsigned int n = methods.size();
+	double timeLeft = trainer->getTimeLeft(this);
+	double cpuLeft = trainer->getTimeLeft(this, true);
+	bool budget = timeLeft >= 0.0 || cpuLeft >= 0.0;
+
+	unsigned int nWorkers = workers;
+	if (!nWorkers) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		nWorkers = cpus > 0 ? (unsigned int)cpus : 1;
+	}
+	nWorkers = std::min(nWorkers, n);
+
+	if (budget && n > 1) {
+		// TMVA trains each method in one go: with a time budget the
+		// first method, the one the calibration is made of, is
+		// trained alone, the others only if the time it took
+		// leaves room for them
+		trainMethods(methods.begin(), methods.begin() + 1,
+		             trainer->trainFileName(this, "root", "output"));
+
+		unsigned int m = affordableMethods(
+			timeLeft - trainer->getTimeLeft(this),
+			cpuLeft - trainer->getTimeLeft(this, true),
+			std::min(nWorkers, n - 1));
+		if (m < n - 1)
+			printf("Time budget: not training %u additional "
+			       "TMVA method(s)\n", n - 1 - m);
+		if (m > 0)
+			trainParallel(1, 1 + m, std::min(nWorkers, m));
+	} else if (nWorkers > 1)
+		trainParallel(0, n, nWorkers);
+	else
+		trainMethods(methods.begin(), methods.begin() + n,
+		             trainer->trainFileName(this, "root", "output"));
 
 	printf("TMVA training factory completed\n");
+
+	// everything still on disk at this point, i.e. the peak usage
+	double disk = fileSize(trainer->trainFileName(this, "root", "output"));
+	if (doExportInput)
+		disk += fileSize(trainer->trainFileName(this, "root", "input"));
+	for(std::vector<Method>::const_iterator iter = methods.begin();
+	    iter != methods.end(); ++iter) {
+		disk += fileSize(trainer->trainFileName(this, "root",
+		                                        "output_" + iter->name));
+		disk += fileSize(getWeightsFile(*iter, "xml"));
+	}
+	printf("TMVA input trees in memory: %.1f MB, peak disk use: "
+	       "%.1f MB\n", (treeSig->GetTotBytes() +
+	                     treeBkg->GetTotBytes()) / 1048576.0,
+	       disk / 1048576.0);
 }
 
 void ProcTMVA::trainEnd()
@@ -380,30 +679,17 @@ void ProcTMVA::trainEnd()
 	    case ITER_EXPORT:
 		/* ROOT context-safe */ {
 			ROOTContextSentinel ctx;
-			file->cd();
-			treeSig->Write();
-			treeBkg->Write();
-
-			file->Close();
-			file.reset();
-			file = std::auto_ptr<TFile>(TFile::Open(
-				trainer->trainFileName(this, "root",
-				                       "input").c_str()));
-			if (!file.get())
-				throw cms::Exception("ProcTMVA")
-					<< "Could not open ROOT file for "
-					   "reading." << std::endl;
-			treeSig = dynamic_cast<TTree*>(
-				file->Get((getTreeName() + "_sig").c_str()));
-			treeBkg = dynamic_cast<TTree*>(
-				file->Get((getTreeName() + "_bkg").c_str()));
+			fillSamples();
+
+			if (doExportInput)
+				exportInput();
 
 			runTMVATrainer();
 
-			file->Close();
+			delete treeSig;
+			delete treeBkg;
 			treeSig = 0;
 			treeBkg = 0;
-			file.reset();
 		}
 		vars.clear();
 
@@ -424,6 +710,8 @@ void ProcTMVA::cleanup()
 	std::remove(trainer->trainFileName(this, "root", "output").c_str());
 	for(std::vector<Method>::const_iterator iter = methods.begin();
 	    iter != methods.end(); ++iter) {
+		std::remove(trainer->trainFileName(this, "root",
+		                                   "output_" + iter->name).c_str());
 		std::remove(getWeightsFile(*iter, "xml").c_str());
 		std::remove(getWeightsFile(*iter, "root").c_str());
 	}
@@ -0,0 +1,226 @@
+#include <stddef.h>
+#include <math.h>
+#include <stdlib.h>
+
+#ifdef MLP_USE_SYSTEM_BLAS
+#	include <cblas.h>
+#endif
+
+#include "mlp_gen.h"
+#include "mlp_blas.h"
+#include "mlp_lapack.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* bundled f2c routine (mlp_lapack.c) */
+/* Subroutine */ int dgels_(char *trans, integer *m, integer *n, integer *
+	nrhs, doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *work, integer *lwork, integer *info);
+
+#ifdef MLP_USE_SYSTEM_BLAS
+/* system LAPACK, Fortran calling convention with 32 bit integers and */
+/* the hidden length of each CHARACTER argument passed last           */
+#	undef dgels_
+void dgels_(const char *trans, const int *m, const int *n, const int *nrhs,
+	    double *a, const int *lda, double *b, const int *ldb,
+	    double *work, const int *lwork, int *info, size_t trans_len);
+void dpotrf_(const char *uplo, const int *n, double *a, const int *lda,
+	     int *info, size_t uplo_len);
+void dpotrs_(const char *uplo, const int *n, const int *nrhs,
+	     const double *a, const int *lda, double *b, const int *ldb,
+	     int *info, size_t uplo_len);
+
+int MLP_Blas = MLP_BLAS_SYSTEM;
+#else
+int MLP_Blas = MLP_BLAS_BUNDLED;
+#endif
+
+/***********************************************************/
+/* MLP_BlasAvailable                                       */
+/*                                                         */
+/* inputs:     int backend = MLP_BLAS_BUNDLED or           */
+/*                           MLP_BLAS_SYSTEM               */
+/*                                                         */
+/* return value (int) = 1 if the backend was built in      */
+/***********************************************************/
+
+int MLP_BlasAvailable(int backend)
+{
+	if(backend == MLP_BLAS_BUNDLED) return 1;
+#ifdef MLP_USE_SYSTEM_BLAS
+	if(backend == MLP_BLAS_SYSTEM) return 1;
+#endif
+	return 0;
+}
+
+
+/***********************************************************/
+/* MLP_BlasName                                            */
+/*                                                         */
+/* inputs:     int backend = MLP_BLAS_BUNDLED or           */
+/*                           MLP_BLAS_SYSTEM               */
+/*                                                         */
+/* return value (const char *) = name of the backend       */
+/***********************************************************/
+
+const char *MLP_BlasName(int backend)
+{
+	return backend == MLP_BLAS_SYSTEM ? "system" : "bundled";
+}
+
+
+/***********************************************************/
+/* MLP_Gemm                                                */
+/*                                                         */
+/* computes a Matrix-Matrix product, same arguments as     */
+/* MLP_GemmAcc:                                            */
+/* C[i][j] = (acc ? C[i][j] : 0) + Sum_k A(i,k) B[k][j]    */
+/* where A(i,k) = A[i*ais + k*aks]                         */
+/*                                                         */
+/* the system dgemm is used when A is stored by lines or   */
+/* by columns, MLP_GemmAcc otherwise                       */
+/***********************************************************/
+
+void MLP_Gemm(int n, int m, int K, dbl *A, int ais, int aks,
+	      dbl *B, int ldb, dbl *C, int ldc, int acc)
+{
+#ifdef MLP_USE_SYSTEM_BLAS
+	if(MLP_Blas == MLP_BLAS_SYSTEM)
+		{
+		if(aks == 1 && ais >= K && ais >= 1)
+			{
+			cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+				n, m, K, 1.0, A, ais, B, ldb,
+				acc ? 1.0 : 0.0, C, ldc);
+			return;
+			}
+		if(ais == 1 && aks >= n && aks >= 1)
+			{
+			cblas_dgemm(CblasRowMajor, CblasTrans, CblasNoTrans,
+				n, m, K, 1.0, A, aks, B, ldb,
+				acc ? 1.0 : 0.0, C, ldc);
+			return;
+			}
+		}
+#endif
+	MLP_GemmAcc(n, m, K, A, ais, aks, B, ldb, C, ldc, acc);
+}
+
+
+/***********************************************************/
+/* MLP_Gels                                                */
+/*                                                         */
+/* solves the least squares problem min |A x - b| by a QR  */
+/* decomposition of A (dgels)                              */
+/*                                                         */
+/* inputs:     int m, n = dimensions of A, m >= n          */
+/*             dbl *A = matrix (m lines, n columns),       */
+/*                      destroyed on output                */
+/*             dbl *b = right hand side (m values), x in   */
+/*                      its first n values on output       */
+/*                                                         */
+/* return value (int) = 0: ok, < 0: not enough memory,     */
+/*                      > 0: A not of full rank            */
+/***********************************************************/
+
+int MLP_Gels(int m, int n, dbl *A, dbl *b)
+{
+	dbl *work;
+	int lwork = n + (m > 1 ? m : 1) * 32;
+
+	work = (dbl *) malloc(lwork*sizeof(dbl));
+	if(work == 0) return -1;
+
+/* A by lines is A^T for Fortran: solve (A^T)^T x = b */
+#ifdef MLP_USE_SYSTEM_BLAS
+	if(MLP_Blas == MLP_BLAS_SYSTEM)
+		{
+		int nrhs = 1, info = 0;
+		dgels_("T", &n, &m, &nrhs, A, &n, b, &m,
+			work, &lwork, &info, 1);
+		free(work);
+		return info;
+		}
+#endif
+	{
+	char trans = 'T';
+	integer M = n, N = m, nrhs = 1, lw = lwork, info = 0;
+	mlp_dgels_(&trans, &M, &N, &nrhs, A, &M, b, &N,
+		work, &lw, &info);
+	free(work);
+	return (int) info;
+	}
+}
+
+
+/***********************************************************/
+/* MLP_Chol                                                */
+/*                                                         */
+/* solves A x = b for a symmetric positive definite A by a */
+/* Cholesky decomposition A = L L^T                        */
+/*                                                         */
+/* inputs:     int n = dimension                           */
+/*             dbl *A = matrix (n*n), destroyed on output  */
+/*             dbl *b = right hand side, x on output       */
+/*                                                         */
+/* return value (int) = 0: ok, 1: A not positive definite  */
+/***********************************************************/
+
+int MLP_Chol(int n, dbl *A, dbl *b)
+{
+	int in, jn, kn;
+	dbl d, t;
+
+/* the lower half by lines is the upper half for Fortran */
+#ifdef MLP_USE_SYSTEM_BLAS
+	if(MLP_Blas == MLP_BLAS_SYSTEM)
+		{
+		int nrhs = 1, info = 0;
+		dpotrf_("U", &n, A, &n, &info, 1);
+		if(info != 0) return 1;
+		dpotrs_("U", &n, &nrhs, A, &n, b, &n, &info, 1);
+		return info != 0;
+		}
+#endif
+
+/* A = L L^T, L stored in the lower half */
+	for(jn=0;jn<n;jn++)
+		{
+		d = A[jn*n+jn];
+		for(kn=0;kn<jn;kn++)
+			d -= A[jn*n+kn]*A[jn*n+kn];
+		if(d <= 0) return 1;
+		d = sqrt(d);
+		A[jn*n+jn] = d;
+		for(in=jn+1;in<n;in++)
+			{
+			t = A[in*n+jn];
+			for(kn=0;kn<jn;kn++)
+				t -= A[in*n+kn]*A[jn*n+kn];
+			A[in*n+jn] = t/d;
+			}
+		}
+
+/* L y = b, then L^T x = y */
+	for(in=0;in<n;in++)
+		{
+		t = b[in];
+		for(kn=0;kn<in;kn++)
+			t -= A[in*n+kn]*b[kn];
+		b[in] = t/A[in*n+in];
+		}
+	for(in=n-1;in>=0;in--)
+		{
+		t = b[in];
+		for(kn=in+1;kn<n;kn++)
+			t -= A[kn*n+in]*b[kn];
+		b[in] = t/A[in*n+in];
+		}
+	return 0;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,41 @@
+#ifndef __private_mlp_blas_h
+#define __private_mlp_blas_h
+
+#if defined(__GNUC__) && (__GNUC__ > 3 || __GNUC__ == 3 && __GNUC_MINOR__ >= 4)
+#	define MLP_HIDDEN __attribute__((visibility("hidden")))
+#endif
+
+#include "mlp_gen.h"
+
+/*
+ * Linear algebra backend of mlpfit.
+ *
+ * The MLP code calls the matrix product, least squares and Cholesky
+ * routines below.  They are implemented with the bundled code (the
+ * vectorised MLP_GemmAcc kernel and the f2c LAPACK of mlp_lapack.c),
+ * or with the system BLAS / LAPACK if the plugin was built with
+ * MLP_USE_SYSTEM_BLAS.  MLP_Blas selects the backend at run time.
+ */
+
+#define MLP_BLAS_BUNDLED	0
+#define MLP_BLAS_SYSTEM		1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int MLP_Blas MLP_HIDDEN;
+
+int		MLP_BlasAvailable(int backend) MLP_HIDDEN;
+const char	*MLP_BlasName(int backend) MLP_HIDDEN;
+
+void	MLP_Gemm(int n, int m, int K, dbl *A, int ais, int aks,
+		 dbl *B, int ldb, dbl *C, int ldc, int acc) MLP_HIDDEN;
+int	MLP_Gels(int m, int n, dbl *A, dbl *b) MLP_HIDDEN;
+int	MLP_Chol(int n, dbl *A, dbl *b) MLP_HIDDEN;
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // __private_mlp_blas_h
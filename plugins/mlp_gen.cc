@@ -2,9 +2,13 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #include "mlp_gen.h"
 #include "mlp_sigmoide.h"
+#include "mlp_simd.h"
+#include "mlp_blas.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -31,6 +35,13 @@ int NetMemory = 0;
 float MLPfitVersion = (float) 1.40;
 dbl LastAlpha = 0;
 int NLineSearchFail = 0;
+int NThreads = 1;
+int NBatch = 0;
+int PatFloat = 0;
+int ShuffleBlock = 0;
+int ShuffleReorder = 0;
+type_pat *PatBuf = 0;
+void (*MLP_PatternPrefetch)(int ifile, int ipat, int npat) = 0;
 
 dbl ***dir;
 dbl *delta;
@@ -40,14 +51,6 @@ dbl **JacobianMatrix;
 int *ExamplesIndex;
 dbl **Hessian;
 
-/* The following lines are needed to use the dgels routine from the LAPACK
-   library in Reslin() 							    */
-
-#include "mlp_lapack.h"
-/* Subroutine */ int dgels_(char *trans, integer *m, integer *n, integer *
-	nrhs, doublereal *a, integer *lda, doublereal *b, integer *ldb, 
-	doublereal *work, integer *lwork, integer *info);
-    
 /***********************************************************/
 /* MLP_Out                                                 */
 /*                                                         */
@@ -248,6 +251,103 @@ L10:
 }
 
 
+/***********************************************************/
+/* MLP_PatRows                                             */
+/*                                                         */
+/* gives access to consecutive patterns (1, inputs) in     */
+/* double precision, whatever the storage (PatFloat):      */
+/* rows of PAT.Rin which are contiguous in memory are      */
+/* returned directly, otherwise (rows from different       */
+/* chunks of an external store, or single precision rows   */
+/* of PAT.RinF) they are copied / converted into buf       */
+/*                                                         */
+/* inputs:     int ifile = file number: 0=learn, 1=test    */
+/*             int ipat = first pattern                    */
+/*             int n = number of patterns                  */
+/*             type_pat *buf = room for n*(Nin+1) values   */
+/*                                                         */
+/* return value (type_pat *) = first pattern row           */
+/***********************************************************/
+
+type_pat *MLP_PatRows(int ifile, int ipat, int n, type_pat *buf)
+{
+	int i, j, nrow = NET.Nneur[0]+1;
+	type_pat *row;
+	float *pf;
+
+	if(PatFloat==0)
+		{
+		row = PAT.Rin[ifile][ipat]-1;
+		if(PAT.Rin[ifile][ipat+n-1]-1 == row+(n-1)*nrow)
+			return row;
+		for(i=0; i<n; i++)
+			memcpy(&(buf[i*nrow]), PAT.Rin[ifile][ipat+i]-1,
+				nrow*sizeof(type_pat));
+		return buf;
+		}
+
+	for(i=0; i<n; i++)
+		{
+		pf = PAT.RinF[ifile][ipat+i]-1;
+		for(j=0; j<nrow; j++)
+			buf[i*nrow+j] = (type_pat) pf[j];
+		}
+	return buf;
+}
+
+
+/***********************************************************/
+/* MLP_PatRowsF                                            */
+/*                                                         */
+/* same as MLP_PatRows for single precision patterns,      */
+/* without conversion                                      */
+/***********************************************************/
+
+float *MLP_PatRowsF(int ifile, int ipat, int n, float *buf)
+{
+	int i, nrow = NET.Nneur[0]+1;
+	float *row;
+
+	row = PAT.RinF[ifile][ipat]-1;
+	if(PAT.RinF[ifile][ipat+n-1]-1 == row+(n-1)*nrow)
+		return row;
+	for(i=0; i<n; i++)
+		memcpy(&(buf[i*nrow]), PAT.RinF[ifile][ipat+i]-1,
+			nrow*sizeof(float));
+	return buf;
+}
+
+
+/***********************************************************/
+/* MLP_OutBuf                                              */
+/*                                                         */
+/* computes the output of the Neural Network into caller   */
+/* supplied buffers instead of NET.Outn / NET.Deriv1, so   */
+/* that several patterns can be processed concurrently     */
+/* inputs:     dbl **vweights = weights of each layer      */
+/*             type_pat *rrin = pattern (1, inputs)        */
+/* outputs:    dbl **outn = outputs of each layer          */
+/*             dbl **deriv1 = derivatives of each layer    */
+/***********************************************************/
+
+void MLP_OutBuf(dbl **vweights, type_pat *rrin, dbl **outn, dbl **deriv1)
+{
+	int il, in;
+
+	memcpy(outn[0], rrin+1, NET.Nneur[0]*sizeof(dbl));
+	MLP_MatrixVectorBias(vweights[1],outn[0],
+			outn[1],NET.Nneur[1],NET.Nneur[0]);
+  	for(il=2; il<NET.Nlayer; il++)
+		{
+		MLP_vSigmoideDeriv(outn[il-1],deriv1[il-1],NET.Nneur[il-1]);
+		MLP_MatrixVectorBias(vweights[il],outn[il-1],
+			outn[il],NET.Nneur[il],NET.Nneur[il-1]);
+		}
+	for(in=0; in<NET.Nneur[NET.Nlayer-1]; in++)
+		deriv1[NET.Nlayer-1][in] = 1;
+}
+
+
 /***********************************************************/
 /* MLP_Test_MM                                             */
 /*                                                         */
@@ -276,7 +376,9 @@ dbl MLP_Test_MM(int ifile, dbl *tmp)
 	err = 0;
 	for(ipat=0; ipat<npat-1; ipat+=2)
 		{
-		MLP_MM2rows(tmp, &(PAT.vRin[ifile][ipat*(nin+1)]), 
+		if(MLP_PatternPrefetch != 0)
+			MLP_PatternPrefetch(ifile, ipat, 2);
+		MLP_MM2rows(tmp, MLP_PatRows(ifile, ipat, 2, PatBuf), 
 		        NET.vWeights[1], 2, nhid, nin+1, 
 			nin+1, nin+1);
 	
@@ -358,7 +460,7 @@ L20:
 	for(ipat=ipat; ipat<npat; ipat++)
 		{
 		MLP_MatrixVector(NET.vWeights[1],
-				&(PAT.vRin[ifile][ipat*(nin+1)]),tmp,
+				MLP_PatRows(ifile, ipat, 1, PatBuf),tmp,
 				nhid,nin+1);
 	
 		switch(NET.T_func[1][0])
@@ -453,6 +555,20 @@ L25:
 	
 	dbl *tmp;
 	
+	if((NBatch!=0 || PatFloat!=0) && (err = MLP_TestBatch(ifile)) >= 0)
+	{
+	if(regul>=1) 
+		{
+		for(in=0; in<NET.Nneur[NET.Nlayer-1]; in++)
+			for(jn=0; jn<=NET.Nneur[NET.Nlayer-2]; jn++)
+			{
+			err += LEARN.Alambda*NET.Weights[NET.Nlayer-1][in][jn]*
+				NET.Weights[NET.Nlayer-1][in][jn];
+			}
+		}
+	return(err);
+	}
+
 	tmp = (dbl *) malloc(2 * NET.Nneur[1] * sizeof(dbl)); 
 	if(tmp == 0)	/* not enough memory */
 	{
@@ -468,7 +584,7 @@ L25:
 			{
 			ipati = ipat;
 			}	
-		MLP_Out_T(PAT.Rin[ifile][ipati]);
+		MLP_Out_T(MLP_PatRows(ifile, ipati, 1, PatBuf)+1);
 		for(in=0; in<NET.Nneur[NET.Nlayer-1]; in++) 
 			{
 			rrans = (dbl) PAT.Rans[ifile][ipati][in];
@@ -532,7 +648,7 @@ L25:
 	if(NET.Debug>=5) printf(" Entry MLP_Stochastic\n");		
 	weights = NET.Weights;
 /* shuffle patterns */		
-	ShuffleExamples(PAT.Npat[0],ExamplesIndex); 
+	MLP_ShuffleEpoch(); 
 		
 /* reduce learning parameter */
 	if(LEARN.Decay<1) EtaDecay();
@@ -546,7 +662,7 @@ L25:
 		ii = ExamplesIndex[ipat];
 		pond = PAT.Pond[0][ii];
 		
-   		MLP_Out2(&(PAT.vRin[0][ii*(NET.Nneur[0]+1)])); 
+   		MLP_Out2(MLP_PatRows(0, ii, 1, PatBuf)); 
 			
 /* next lines are equivalent to DeDwSum */			    
  		for(in=0; in<NET.Nneur[NET.Nlayer-1]; in++) 
@@ -688,6 +804,211 @@ L2:				NET.Delta[il][in] = a*deriv;
 }
 
 
+/***********************************************************/
+/* MLP_StochasticParallel                                  */
+/*                                                         */
+/* one epoch of MLP stochastic training, the shuffled      */
+/* examples being split into nthreads slices that are      */
+/* processed concurrently. The weights (and the momentum   */
+/* terms) are shared and updated without any locking       */
+/* ("Hogwild" scheme): updates from different threads may  */
+/* occasionally overwrite each other, which does not       */
+/* harm convergence as long as the network is not tiny     */
+/* compared to the number of threads.                      */
+/*                                                         */
+/* inputs:     int nthreads = number of worker threads     */
+/*                                                         */
+/* return value (dbl) = error value on learning sample     */
+/*                      (sum over all threads)             */
+/***********************************************************/
+
+struct stochslice_
+{
+	int first, last;
+	dbl eta, eps, err;
+	dbl **outn, **deriv1, **delta;
+	type_pat *row;
+};
+
+static void *MLP_StochasticSlice(void *arg)
+{
+	struct stochslice_ *slice = (struct stochslice_ *) arg;
+	int ipat, ii, il, in, in1;
+	dbl a, b, pond;
+	dbl *pw, *pout;
+	dbl eta = slice->eta;
+	dbl eps = slice->eps;
+	dbl **outn = slice->outn;
+	dbl **deriv1 = slice->deriv1;
+	dbl **delta = slice->delta;
+	dbl ***weights = NET.Weights;
+	int nl = NET.Nlayer-1;
+
+	slice->err = 0;
+	for(ipat=slice->first; ipat<slice->last; ipat++)
+		{
+		ii = ExamplesIndex[ipat];
+		pond = PAT.Pond[0][ii];
+
+		MLP_OutBuf(NET.vWeights, MLP_PatRows(0, ii, 1, slice->row),
+			outn, deriv1);
+
+/* output layer */
+		for(in=0; in<NET.Nneur[nl]; in++)
+			{
+			b = outn[nl][in] - (dbl) PAT.Rans[0][ii][in];
+			slice->err += b*b*pond;
+			delta[nl][in] = b*deriv1[nl][in]*pond*eta;
+			}
+
+/* hidden layers */
+		for(il=nl-1; il>0; il--)
+			for(in=0; in<NET.Nneur[il]; in++)
+				{
+				a = 0;
+				for(in1=0; in1<NET.Nneur[il+1]; in1++)
+					a += delta[il+1][in1] *
+						weights[il+1][in1][in+1];
+				delta[il][in] = a*deriv1[il][in];
+				}
+
+/* update the shared weights */
+		for(il=1; il<=nl; il++)
+			for(in=0; in<NET.Nneur[il]; in++)
+				{
+				a = delta[il][in];
+				pw = weights[il][in];
+				pout = outn[il-1];
+				if(eps==0)
+					{
+					pw[0] += a;
+					for(in1=1; in1<=NET.Nneur[il-1];
+						in1++, pout++)
+						pw[in1] += a * *pout;
+					}
+				else
+					{
+					dbl *podw = LEARN.Odw[il][in];
+					podw[0] = a + eps*podw[0];
+					pw[0] += podw[0];
+					for(in1=1; in1<=NET.Nneur[il-1];
+						in1++, pout++)
+						{
+						podw[in1] = a * *pout +
+							eps*podw[in1];
+						pw[in1] += podw[in1];
+						}
+					}
+				}
+		}
+	return 0;
+}
+
+static void MLP_FreeSlices(struct stochslice_ *slices, int nthreads)
+{
+	int it, il;
+
+	for(it=0; it<nthreads; it++)
+		{
+		for(il=0; il<NET.Nlayer; il++)
+			{
+			if(slices[it].outn) free(slices[it].outn[il]);
+			if(slices[it].deriv1) free(slices[it].deriv1[il]);
+			if(slices[it].delta) free(slices[it].delta[il]);
+			}
+		free(slices[it].outn);
+		free(slices[it].deriv1);
+		free(slices[it].delta);
+		free(slices[it].row);
+		}
+	free(slices);
+}
+
+dbl MLP_StochasticParallel(int nthreads)
+{
+	struct stochslice_ *slices;
+	pthread_t *threads;
+	dbl err = 0;
+	int it, il, nalloc, ok;
+
+	if(NET.Debug>=5) printf(" Entry MLP_StochasticParallel\n");
+	if(nthreads>PAT.Npat[0]) nthreads = PAT.Npat[0];
+	if(nthreads<=1) return MLP_Stochastic();
+
+/* thread buffers first: without them the epoch is done serially */
+	slices = (struct stochslice_ *) calloc(nthreads,
+						sizeof(struct stochslice_));
+	threads = (pthread_t *) malloc(nthreads*sizeof(pthread_t));
+	ok = slices != 0 && threads != 0;
+	for(it=0; ok && it<nthreads; it++)
+		{
+		slices[it].outn = (dbl **) calloc(NET.Nlayer,sizeof(dbl*));
+		slices[it].deriv1 = (dbl **) calloc(NET.Nlayer,sizeof(dbl*));
+		slices[it].delta = (dbl **) calloc(NET.Nlayer,sizeof(dbl*));
+		slices[it].row = (type_pat *)
+			malloc((NET.Nneur[0]+1)*sizeof(type_pat));
+		ok = slices[it].outn != 0 && slices[it].deriv1 != 0 &&
+		     slices[it].delta != 0 && slices[it].row != 0;
+		for(il=0; ok && il<NET.Nlayer; il++)
+			{
+			slices[it].outn[il] = (dbl *)
+				malloc(NET.Nneur[il]*sizeof(dbl));
+			slices[it].deriv1[il] = (dbl *)
+				malloc(NET.Nneur[il]*sizeof(dbl));
+			slices[it].delta[il] = (dbl *)
+				malloc(NET.Nneur[il]*sizeof(dbl));
+			ok = slices[it].outn[il] != 0 &&
+			     slices[it].deriv1[il] != 0 &&
+			     slices[it].delta[il] != 0;
+			}
+		}
+	if(!ok)
+		{
+		printf("not enough memory in MLP_StochasticParallel\n");
+		if(slices) MLP_FreeSlices(slices, nthreads);
+		free(threads);
+		return MLP_Stochastic();
+		}
+
+/* shuffle patterns */
+	MLP_ShuffleEpoch();
+
+/* reduce learning parameter */
+	if(LEARN.Decay<1) EtaDecay();
+
+	for(it=0; it<nthreads; it++)
+		{
+		slices[it].first = (int) ((long) PAT.Npat[0]*it/nthreads);
+		slices[it].last = (int) ((long) PAT.Npat[0]*(it+1)/nthreads);
+		slices[it].eta = -LEARN.eta;
+		slices[it].eps = LEARN.epsilon;
+		}
+
+	nalloc = 0;
+	for(it=1; it<nthreads; it++, nalloc++)
+		if(pthread_create(&threads[it], 0, MLP_StochasticSlice,
+				  &slices[it]) != 0)
+			break;
+	if(nalloc<nthreads-1)
+		{
+/* could not start all threads, do the remaining slices here */
+		for(it=nalloc+1; it<nthreads; it++)
+			MLP_StochasticSlice(&slices[it]);
+		}
+	MLP_StochasticSlice(&slices[0]);
+	for(it=1; it<=nalloc; it++)
+		pthread_join(threads[it], 0);
+
+/* reduce the error and free the thread buffers */
+	for(it=0; it<nthreads; it++)
+		err += slices[it].err;
+	MLP_FreeSlices(slices, nthreads);
+	free(threads);
+
+	return(err);
+}
+
+
 /***********************************************************/
 /* MLP_Epoch                                               */
 /*                                                         */
@@ -724,7 +1045,13 @@ L2:				NET.Delta[il][in] = a*deriv;
 	if(LEARN.Meth==1) 
 		{
 
-		err = MLP_Stochastic();
+		if(ShuffleBlock!=0 && (ShuffleReorder>0 ?
+		   (iepoch-1)%ShuffleReorder==0 : iepoch==1))
+			MLP_ReorderPatterns();
+		if(NThreads>1)
+			err = MLP_StochasticParallel(NThreads);
+		else
+			err = MLP_Stochastic();
 			
 		}
 	else
@@ -751,10 +1078,17 @@ L2:				NET.Delta[il][in] = a*deriv;
 			} 
 		else
 			{
-			for(ipat=0;ipat<PAT.Npat[0];ipat++)
+			if((NBatch==0 && PatFloat==0) ||
+			   (err = MLP_TrainBatch()) < 0)
 				{
-				ierr = MLP_Train(&ipat,&err);
-				if(ierr!=0) printf("Epoch: ierr= %d\n",ierr);
+				err = 0;
+				for(ipat=0;ipat<PAT.Npat[0];ipat++)
+					{
+					if(MLP_PatternPrefetch != 0)
+						MLP_PatternPrefetch(0, ipat, 1);
+					ierr = MLP_Train(&ipat,&err);
+					if(ierr!=0) printf("Epoch: ierr= %d\n",ierr);
+					}
 				}
 			}
 		DeDwScale(PAT.Npat[0]);
@@ -903,7 +1237,7 @@ L2:				NET.Delta[il][in] = a*deriv;
 	if(*ipat<0) return(2);
         
 /*    	MLP_Out(PAT.Rin[0][*ipat],NET.Outn[NET.Nlayer-1]);*/
-    	MLP_Out2(&(PAT.vRin[0][*ipat*(NET.Nneur[0]+1)]));
+    	MLP_Out2(MLP_PatRows(0, *ipat, 1, PatBuf));
 	for(in=0; in<NET.Nneur[NET.Nlayer-1]; in++) 
 		{
 		*err  += ((dbl) PAT.Rans[0][*ipat][in]-NET.Outn[NET.Nlayer-1][in])
@@ -914,6 +1248,319 @@ L2:				NET.Delta[il][in] = a*deriv;
     	return(0); 
 } 
 
+
+/***********************************************************/
+/* MLP_BatchSize                                           */
+/*                                                         */
+/* number of patterns processed together in mini-batch     */
+/* mode: NBatch if positive, otherwise chosen such that    */
+/* the activations, derivatives and deltas of a block, the */
+/* transposed weights and the gradient fill about half of  */
+/* the L2 cache (256 kB assumed if it cannot be queried)   */
+/*                                                         */
+/* return value (int) = number of patterns per block       */
+/***********************************************************/
+
+static long MLP_L2Size()
+{
+	long l2 = 0;
+
+#ifdef _SC_LEVEL2_CACHE_SIZE
+	l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+	if(l2 <= 0) l2 = 256*1024;
+	return l2;
+}
+
+int MLP_BatchSize()
+{
+	long l2, perpat = 0, wbytes = 0, nb;
+	int il;
+
+	if(NBatch>0) return NBatch;
+
+	l2 = MLP_L2Size();
+
+	for(il=0; il<NET.Nlayer; il++)
+		perpat += 3*NET.Nneur[il]+1;
+	if(PatFloat!=0)
+		perpat += NET.Nneur[0]+1;
+	for(il=1; il<NET.Nlayer; il++)
+		wbytes += 2*NET.Nneur[il]*(NET.Nneur[il-1]+1);
+	perpat *= sizeof(dbl);
+	wbytes *= sizeof(dbl);
+
+	nb = (l2/2 - wbytes) / perpat;
+	if(nb < 16) nb = 16;
+	if(nb > 4096) nb = 4096;
+	return (int) nb;
+}
+
+
+/***********************************************************/
+/* MLP_BatchPass                                           */
+/*                                                         */
+/* computes the error (and the gradient) on a pattern file */
+/* by blocks of MLP_BatchSize() patterns: the products     */
+/* with the weights of one layer are done for the whole    */
+/* block at once as matrix - matrix products (MLP_Gemm)    */
+/* instead of one matrix - vector product per pattern.     */
+/* Same transfer functions as MLP_Out2 (sigmoid for the    */
+/* hidden layers, linear output), results identical to    */
+/* MLP_Test / MLP_Train + DeDwSum up to summation order.   */
+/* With single precision patterns (PatFloat=2) the input   */
+/* layer product is done in single precision directly on   */
+/* PAT.RinF, everything else stays in double precision.    */
+/*                                                         */
+/* inputs:     int ifile = file number: 0=learn, 1=test    */
+/*             int train = 1: add the gradient to DeDw     */
+/*                                                         */
+/* return value (dbl) = error value, -1 if not enough      */
+/*                      memory for the block buffers       */
+/***********************************************************/
+
+/* block buffers of MLP_BatchPass, kept from one pass (and line	*/
+/* search probe) to the next, freed by MLP_FreeBatch when the	*/
+/* patterns or the network change				*/
+static struct
+{
+	int nb;			/* patterns per block, 0: not allocated */
+	int nlayer;
+	dbl **H, **D, **Dv, **WT, **G;
+	dbl *X;
+	float *WTF, *XF;
+} BatchBuf;
+
+void MLP_FreeBatch()
+{
+	int il;
+
+	if(BatchBuf.H != 0)
+		for(il=1; il<BatchBuf.nlayer; il++)
+			{
+			free(BatchBuf.H[il]);
+			free(BatchBuf.D[il]);
+			free(BatchBuf.Dv[il]);
+			free(BatchBuf.WT[il]);
+			free(BatchBuf.G[il]);
+			}
+	free(BatchBuf.H);
+	free(BatchBuf.X);
+	free(BatchBuf.XF);
+	free(BatchBuf.WTF);
+	memset(&BatchBuf, 0, sizeof(BatchBuf));
+}
+
+/* H[il] = outputs of layer il with a leading 1 (bias) column,	*/
+/* D[il] = deltas, Dv[il] = sigmoid derivatives,		*/
+/* WT[il] = transposed weights, G[il] = gradient of the pass	*/
+static int MLP_AllocBatch(int nb)
+{
+	int nl = NET.Nlayer-1;
+	int nin = NET.Nneur[0];
+	int il, in, jn, ok;
+
+	if(BatchBuf.nb >= nb && BatchBuf.nlayer == NET.Nlayer &&
+	   (PatFloat!=2 || BatchBuf.XF != 0)) return 0;
+	MLP_FreeBatch();
+
+	BatchBuf.H = (dbl **) calloc(5*NET.Nlayer, sizeof(dbl *));
+	if(BatchBuf.H == 0) return -1;
+	BatchBuf.nlayer = NET.Nlayer;
+	BatchBuf.D = BatchBuf.H + NET.Nlayer;
+	BatchBuf.Dv = BatchBuf.D + NET.Nlayer;
+	BatchBuf.WT = BatchBuf.Dv + NET.Nlayer;
+	BatchBuf.G = BatchBuf.WT + NET.Nlayer;
+
+	ok = 1;
+	for(il=1; il<=nl; il++)
+		{
+		in = NET.Nneur[il];
+		jn = NET.Nneur[il-1]+1;
+		BatchBuf.H[il] = (dbl *) malloc(nb*(in+1)*sizeof(dbl));
+		BatchBuf.D[il] = (dbl *) malloc(nb*in*sizeof(dbl));
+		BatchBuf.Dv[il] = (dbl *) malloc(nb*in*sizeof(dbl));
+		BatchBuf.WT[il] = (dbl *) malloc(jn*in*sizeof(dbl));
+		BatchBuf.G[il] = (dbl *) malloc(jn*in*sizeof(dbl));
+		if(BatchBuf.H[il] == 0 || BatchBuf.D[il] == 0 ||
+		   BatchBuf.Dv[il] == 0 || BatchBuf.WT[il] == 0 ||
+		   BatchBuf.G[il] == 0) ok = 0;
+		}
+	BatchBuf.X = (dbl *) malloc(nb*(nin+1)*sizeof(dbl));
+	if(BatchBuf.X == 0) ok = 0;
+	if(PatFloat==2)
+		{
+		BatchBuf.WTF = (float *)
+			malloc((nin+1)*NET.Nneur[1]*sizeof(float));
+		BatchBuf.XF = (float *) malloc(nb*(nin+1)*sizeof(float));
+		if(BatchBuf.WTF == 0 || BatchBuf.XF == 0) ok = 0;
+		}
+
+	if(!ok)
+		{
+		MLP_FreeBatch();
+		return -1;
+		}
+	BatchBuf.nb = nb;
+	return 0;
+}
+
+static dbl MLP_BatchPass(int ifile, int train)
+{
+	int nl = NET.Nlayer-1;
+	int nin = NET.Nneur[0];
+	int npat = PAT.Npat[ifile];
+	int nb, ib, ip, il, in, jn, ld;
+	dbl err = 0, b, pond;
+	dbl **H, **D, **Dv, **WT, **G;
+	dbl *out, *pdelta, *X;
+	float *WTF, *XF;
+
+	nb = MLP_BatchSize();
+	if(nb > npat) nb = npat;
+	if(nb < 1) return 0;
+
+	if(MLP_AllocBatch(nb) != 0) return -1;
+	H = BatchBuf.H;
+	D = BatchBuf.D;
+	Dv = BatchBuf.Dv;
+	WT = BatchBuf.WT;
+	G = BatchBuf.G;
+	X = BatchBuf.X;
+	WTF = PatFloat==2 ? BatchBuf.WTF : 0;
+	XF = BatchBuf.XF;
+
+	if(train)
+		for(il=1; il<=nl; il++)
+			memset(G[il], 0, NET.Nneur[il]*(NET.Nneur[il-1]+1)*
+					 sizeof(dbl));
+
+	for(il=1; il<=nl; il++)
+		{
+		ld = NET.Nneur[il-1]+1;
+		for(in=0; in<NET.Nneur[il]; in++)
+			for(jn=0; jn<ld; jn++)
+				WT[il][jn*NET.Nneur[il]+in] =
+					NET.vWeights[il][in*ld+jn];
+		}
+	if(WTF)
+		for(in=0; in<(nin+1)*NET.Nneur[1]; in++)
+			WTF[in] = (float) WT[1][in];
+
+	for(ib=0; ib<npat; ib+=nb)
+		{
+		if(nb > npat-ib) nb = npat-ib;
+		if(MLP_PatternPrefetch != 0)
+			MLP_PatternPrefetch(ifile, ib, nb);
+
+/* forward pass, the input block is read in place when its	*/
+/* rows are contiguous, otherwise gathered into X (XF)		*/
+		if(PatFloat!=2 || train)
+			H[0] = MLP_PatRows(ifile, ib, nb, X);
+		for(il=1; il<=nl; il++)
+			{
+			ld = NET.Nneur[il]+1;
+			if(il==1 && PatFloat==2)
+				MLP_GemmF(nb, NET.Nneur[1], nin+1,
+					MLP_PatRowsF(ifile, ib, nb, XF), nin+1,
+					WTF, NET.Nneur[1], H[1]+1, ld);
+			else
+				MLP_Gemm(nb, NET.Nneur[il],
+					NET.Nneur[il-1]+1,
+					H[il-1], NET.Nneur[il-1]+1, 1,
+					WT[il], NET.Nneur[il], H[il]+1, ld, 0);
+			for(ip=0; ip<nb; ip++)
+				{
+				H[il][ip*ld] = 1;
+				if(il<nl)
+					MLP_vSigmoideDeriv(&(H[il][ip*ld+1]),
+					     &(Dv[il][ip*NET.Nneur[il]]),
+					     NET.Nneur[il]);
+				}
+			}
+
+/* error and output deltas (linear output: derivative = 1) */
+		ld = NET.Nneur[nl]+1;
+		for(ip=0; ip<nb; ip++)
+			{
+			pond = (dbl) PAT.Pond[ifile][ib+ip];
+			out = &(H[nl][ip*ld+1]);
+			pdelta = &(D[nl][ip*NET.Nneur[nl]]);
+			for(in=0; in<NET.Nneur[nl]; in++)
+				{
+				b = out[in] - (dbl) PAT.Rans[ifile][ib+ip][in];
+				err += b*b*pond;
+				pdelta[in] = b*pond;
+				}
+			}
+		if(!train) continue;
+
+/* back propagation: D[il] = (D[il+1] W[il+1]) * sigmoid' */
+		for(il=nl-1; il>0; il--)
+			{
+			MLP_Gemm(nb, NET.Nneur[il], NET.Nneur[il+1],
+				D[il+1], NET.Nneur[il+1], 1,
+				NET.vWeights[il+1]+1, NET.Nneur[il]+1,
+				D[il], NET.Nneur[il], 0);
+			for(in=0; in<nb*NET.Nneur[il]; in++)
+				D[il][in] *= Dv[il][in];
+			}
+
+/* gradient: G[il] += D[il]^T H[il-1] */
+		for(il=1; il<=nl; il++)
+			{
+			ld = NET.Nneur[il-1]+1;
+			MLP_Gemm(NET.Nneur[il], ld, nb,
+				D[il], 1, NET.Nneur[il],
+				H[il-1], ld, G[il], ld, 1);
+			}
+		}
+
+	if(train)
+		for(il=1; il<=nl; il++)
+			{
+			ld = NET.Nneur[il-1]+1;
+			for(in=0; in<NET.Nneur[il]; in++)
+				for(jn=0; jn<ld; jn++)
+					LEARN.DeDw[il][in][jn] +=
+						G[il][in*ld+jn];
+			}
+	return(err);
+}
+
+
+/***********************************************************/
+/* MLP_TrainBatch                                          */
+/*                                                         */
+/* mini-batch equivalent of calling MLP_Train for all the  */
+/* learning patterns (see MLP_BatchPass)                   */
+/*                                                         */
+/* return value (dbl) = error value, -1 if not enough      */
+/*                      memory (nothing has been done)     */
+/***********************************************************/
+
+dbl MLP_TrainBatch()
+{
+	return MLP_BatchPass(0, 1);
+}
+
+
+/***********************************************************/
+/* MLP_TestBatch                                           */
+/*                                                         */
+/* mini-batch computation of the error on a pattern file,  */
+/* without regularisation term (see MLP_BatchPass)         */
+/* inputs:     int ifile = file number: 0=learn, 1=test    */
+/*                                                         */
+/* return value (dbl) = error value, -1 if not enough      */
+/*                      memory                             */
+/***********************************************************/
+
+dbl MLP_TestBatch(int ifile)
+{
+	return MLP_BatchPass(ifile, 0);
+}
+
       	  
 /***********************************************************/
 /* StochStepHyb                                            */
@@ -1462,11 +2109,53 @@ void SetDefaultFuncs()
 }
 
 
+/***********************************************************/
+/* MLP_SolveNormal                                         */
+/*                                                         */
+/* solves the normal equations A x = b of MLP_ResLin by a  */
+/* Cholesky decomposition, or as a least squares problem   */
+/* (QR decomposition) if A is not numerically positive     */
+/* definite                                                */
+/*                                                         */
+/* inputs:     int n = dimension                           */
+/*             dbl *A = matrix (n*n), destroyed on output  */
+/*             dbl *b = right hand side, x on output       */
+/*                                                         */
+/* return value (int) = 0: ok, 1: no solution              */
+/***********************************************************/   
+
+static int MLP_SolveNormal(int n, dbl *A, dbl *b)
+{
+	dbl *A0;
+	int in, ok;
+
+	A0 = (dbl *) malloc((n*n+n)*sizeof(dbl));
+	if(A0 == 0) return MLP_Chol(n, A, b) != 0;
+	memcpy(A0, A, n*n*sizeof(dbl));
+	memcpy(A0+n*n, b, n*sizeof(dbl));
+
+	ok = MLP_Chol(n, A, b) == 0;
+	if(!ok && MLP_Gels(n, n, A0, A0+n*n) == 0)
+		{
+		ok = 1;
+		for(in=0; in<n; in++)
+			if(!isfinite(A0[n*n+in])) ok = 0;
+		if(ok) memcpy(b, A0+n*n, n*sizeof(dbl));
+		}
+	free(A0);
+	return !ok;
+}
+
+
 /***********************************************************/
 /* LineSearch                                              */
 /*                                                         */
 /* search along the line defined by dir                    */
 /*                                                         */
+/* every probe is one sweep over the learning patterns;    */
+/* probing several step lengths per sweep was measured     */
+/* slower (the sweep is compute bound, even from a file)   */
+/*                                                         */
 /* outputs:     dbl *alpmin = optimal step length          */
 /*                                                         */
 /* Author: B.Mansoulie     01-Jul-98                       */
@@ -1959,6 +2648,12 @@ void SetLambda(double Wmax)
 /* resolution of linear system of equations for hybrid     */
 /* training method 		                           */
 /*                                                         */
+/* the weighted least squares problem for the weights of   */
+/* the (linear) output neuron is solved through its normal */
+/* equations  (H^T W H + lambda2 I) w = H^T W t, which are */
+/* accumulated while streaming over the examples: memory   */
+/* ~ (number of linear weights)^2, whatever the number of  */
+/* examples, instead of the full H matrix for dgels        */
 /*                                                         */
 /* Author: B.Mansoulie        end-98                       */
 /* Modified: J.Schwindling 29-APR-99			   */
@@ -1968,74 +2663,56 @@ void SetLambda(double Wmax)
 /* extern "C"Dllexport */
 void MLP_ResLin()
 {
-/*	dbl rrans[NMAX], rrout[NMAX];*/
-/*	type_pat rrin[NMAX];*/
-	doublereal *HR,*dpat; //,*wlin,*SV;
-	double err,lambda,lambda2;
-	integer Nl,M,Nhr,khr,nrhs,iret,ierr;
-	int   il, in, inl, ipat;
-	/*register dbl a;*/ //a unused
-	char Trans = 'N';
-
-	
-/*	integer rank; */
-//	doublereal rcond = -1;	/* use machine precision */
+	dbl *A, *b, *Hb, *hrow;
+	dbl err, lambda2, sw, t;
+	int Nl, il, in, inl, ipat, nb, ib;
 	
 	lambda2 = LEARN.Alambda;
 	
-/* Nl = number of linear weights
-   M = number of terms in linear system = number of examples + regularisation*/
-	Nl = NET.Nneur[NET.Nlayer-2] + 1;
-	M = PAT.Npat[0]+Nl;
+/* Nl = number of linear weights */
+	il = NET.Nlayer-2;
+	Nl = NET.Nneur[il] + 1;
+	nb = 64;
 
-	integer Lwork = 5 * M;
-        doublereal *Work = (doublereal*) malloc((int) Lwork*sizeof(doublereal));
-	
 /* memory allocation */
-	dpat = (doublereal*) malloc((int) M*sizeof(doublereal));
-//	wlin = (doublereal*) malloc((int) Nl*sizeof(doublereal));
-//	SV = (doublereal*) malloc((int) Nl*sizeof(doublereal));
-	
-	Nhr = M * Nl;
-	HR = (doublereal*) malloc((int) Nhr*sizeof(doublereal));
-	err = 0.;
-	for(ipat=0;ipat<PAT.Npat[0];ipat++)
+	A = (dbl *) calloc(Nl*Nl, sizeof(dbl));
+	b = (dbl *) calloc(Nl, sizeof(dbl));
+	Hb = (dbl *) malloc(nb*Nl*sizeof(dbl));
+	if(A == 0 || b == 0 || Hb == 0)
 		{
-/* *** Filling dpat and HR *** */
-/*		for(in=0; in<NET.Nneur[0]; in++)
-			{
-			rrin[in] = PAT.Rin[0][ipat][in];
-			}*/
-
-		MLP_Out(PAT.Rin[0][ipat],NET.Outn[NET.Nlayer-1]);
-/*		MLP_Out(rrin,rrout);*/
-		/*for(in=0; in<NET.Nneur[NET.Nlayer-1]; in++)
-			{ 
-			  a = (dbl) PAT.Rans[0][ipat][in]; //a was not used
-			} */
-		il = NET.Nlayer-2;
-		dpat[ipat] = (dbl) PAT.Rans[0][ipat][0]*sqrt(PAT.Pond[0][ipat]);
-		khr = ipat;
-		HR[khr] = (dbl) sqrt(PAT.Pond[0][ipat]);
-		for(in=0;in<NET.Nneur[il];in++)
-			{
-			khr =  M *(in+1) + ipat;
-			HR[khr] = NET.Outn[il][in]* 
-				(dbl) sqrt(PAT.Pond[0][ipat]);
-			}
+		printf("not enough memory in MLP_ResLin\n");
+		free(A);
+		free(b);
+		free(Hb);
+		return;
 		}
-	il = NET.Nlayer-2;
-	lambda = sqrt(lambda2);
-	for(ipat=0;ipat<=NET.Nneur[il];ipat++)
+
+/* A = Sum w h h^T, b = Sum w t h, h = (1, last hidden layer),	*/
+/* by blocks of nb examples: A += Hb^T Hb			*/
+	ib = 0;
+	for(ipat=0;ipat<PAT.Npat[0];ipat++)
 		{
-		dpat[ipat+PAT.Npat[0]] = 0;
-		for(in=0;in<=NET.Nneur[il];in++)
+		if(MLP_PatternPrefetch != 0)
+			MLP_PatternPrefetch(0, ipat, 1);
+		MLP_Out(MLP_PatRows(0, ipat, 1, PatBuf)+1,
+			NET.Outn[NET.Nlayer-1]);
+		sw = sqrt((dbl) PAT.Pond[0][ipat]);
+		t = (dbl) PAT.Rans[0][ipat][0]*sw;
+		hrow = &(Hb[ib*Nl]);
+		hrow[0] = sw;
+		for(in=0;in<NET.Nneur[il];in++)
+			hrow[in+1] = NET.Outn[il][in]*sw;
+		for(in=0;in<Nl;in++)
+			b[in] += hrow[in]*t;
+		if(++ib == nb || ipat == PAT.Npat[0]-1)
 			{
-			khr =  M *in + ipat + PAT.Npat[0];
-			HR[khr] = 0;
-			if(in==ipat) HR[khr]=lambda;
+			MLP_Gemm(Nl, Nl, ib, Hb, 1, Nl, Hb, Nl, A, Nl, 1);
+			ib = 0;
 			}
 		}
+	for(in=0;in<Nl;in++)
+		A[in*Nl+in] += lambda2;
+
 	if(NET.Debug>=4) 
 		{
 		err = MLP_Test(0,0);
@@ -2044,32 +2721,28 @@ void MLP_ResLin()
 /*                                                                */
 /*      Trouve les poids lineaires par resolution lineaire        */
 /*                                                                */
-	nrhs = 1;
-	ierr = dgels_(&Trans,&M,&Nl,&nrhs,HR,&M,dpat,&M,Work,
-			&Lwork,&iret);
-	if(iret != 0) printf("Warning from dgels: iret = %d\n",(int)iret);
-	if(ierr != 0) printf("Warning from dgels: ierr = %d\n",(int)ierr);
-	
-/*	ierr = dgelss_(&M,&Nl,&nrhs,HR,&M,dpat,&M,SV,&rcond,&rank,Work,&Lwork,
-		&iret);
-	if(iret != 0) printf("Warning from dgelss: iret = %d\n",iret);
-	if(ierr != 0) printf("Warning from dgelss: ierr = %d\n",ierr);*/
+	if(MLP_SolveNormal(Nl, A, b) != 0)
+		{
+		printf("Warning from ResLin: no solution\n");
+		free(A);
+		free(b);
+		free(Hb);
+		return;
+		}
 	
 	il = NET.Nlayer-1;
 	for (inl=0; inl<=NET.Nneur[il-1];inl++)
 		{
-		NET.Weights[il][0][inl] = dpat[inl];
+		NET.Weights[il][0][inl] = b[inl];
 		}
 	if(NET.Debug>=4) 
 		{
 		err = MLP_Test(0,0);
 		printf("ResLin, apres tlsfor, err= %f\n",err); 
 		}		 
-	free(Work);
-	free(dpat);
-//	free(wlin);
-	free(HR);
-//	free(SV);
+	free(A);
+	free(b);
+	free(Hb);
 }
 
 /***********************************************************/
@@ -2113,6 +2786,143 @@ int ShuffleExamples(int n, int *index)
 }
 
 
+/***********************************************************/
+/* ShuffleBlocks                                           */
+/*                                                         */
+/* Shuffles the learning examples by blocks: the blocks of */
+/* nblock consecutive examples are visited in random order */
+/* and the examples of each block in random order, so that */
+/* a block stays in cache while it is being used           */
+/*                                                         */
+/* inputs :	int n = number of examples                 */
+/*		int *index = new order of the examples     */
+/*		int nblock = number of examples per block  */
+/***********************************************************/   
+
+int ShuffleBlocks(int n, int *index, int nblock)
+{
+	int ib, j, first, len, pos, nb;
+	int *order;
+
+	nb = (n+nblock-1)/nblock;
+	order = (int *) malloc(nb*sizeof(int));
+	if(order == 0) return ShuffleExamples(n,index);
+
+	for(ib=0; ib<nb; ib++) order[ib] = ib;
+	ShuffleExamples(nb,order);
+
+	pos = 0;
+	for(ib=0; ib<nb; ib++)
+		{
+		first = order[ib]*nblock;
+		len = n-first < nblock ? n-first : nblock;
+		for(j=0; j<len; j++) index[pos+j] = first+j;
+		ShuffleExamples(len,&(index[pos]));
+		pos += len;
+		}
+	free(order);
+	return 0;
+}
+
+
+/***********************************************************/
+/* MLP_ShuffleBlockSize                                    */
+/*                                                         */
+/* number of examples per block for ShuffleBlocks:         */
+/* ShuffleBlock if positive, otherwise such that the       */
+/* examples of a block (inputs, answers, weights and table */
+/* entries) fill about half of the L2 cache                */
+/***********************************************************/   
+
+int MLP_ShuffleBlockSize()
+{
+	long perpat, nb;
+
+	if(ShuffleBlock>0) return ShuffleBlock;
+
+	perpat = (NET.Nneur[0]+1)*(PatFloat ? sizeof(float) : sizeof(dbl))
+	       + NET.Nneur[NET.Nlayer-1]*sizeof(type_pat)
+	       + sizeof(type_pat) + 2*sizeof(void *) + sizeof(int);
+	nb = MLP_L2Size()/2/perpat;
+	if(nb < 16) nb = 16;
+	return (int) nb;
+}
+
+
+/***********************************************************/
+/* MLP_ShuffleEpoch                                        */
+/*                                                         */
+/* new order of the learning examples for a stochastic     */
+/* epoch: full shuffle (ShuffleBlock = 0) or by blocks     */
+/***********************************************************/   
+
+void MLP_ShuffleEpoch()
+{
+	if(ShuffleBlock==0)
+		ShuffleExamples(PAT.Npat[0],ExamplesIndex);
+	else
+		ShuffleBlocks(PAT.Npat[0],ExamplesIndex,
+			      MLP_ShuffleBlockSize());
+}
+
+
+/***********************************************************/
+/* MLP_ReorderPatterns                                     */
+/*                                                         */
+/* randomly permutes the learning examples in memory       */
+/* (inputs, answers and weights are moved, the tables stay */
+/* as they are), so that the blocks of ShuffleBlocks are   */
+/* made of different examples. Done by MLP_Epoch in the    */
+/* first epoch and then every ShuffleReorder epochs.       */
+/* Fisher-Yates shuffle: example i is swapped with one     */
+/* drawn uniformly from i .. n-1                           */
+/***********************************************************/   
+
+void MLP_ReorderPatterns()
+{
+	int i, ii, j, nin, nout, n;
+	type_pat tmp, *p1, *p2;
+	float tmpf, *f1, *f2;
+
+	n = PAT.Npat[0];
+	nin = NET.Nneur[0];
+	nout = NET.Nneur[NET.Nlayer-1];
+
+	for(i=0; i<n-1; i++)
+		{
+		ii = i + (int) ((n - i) * (random() / (RAND_MAX + 1.0)));
+		if(ii==i) continue;
+		if(PatFloat==0)
+			{
+			p1 = PAT.Rin[0][i];
+			p2 = PAT.Rin[0][ii];
+			for(j=0; j<nin; j++)
+				{
+				tmp = p1[j]; p1[j] = p2[j]; p2[j] = tmp;
+				}
+			}
+		else
+			{
+			f1 = PAT.RinF[0][i];
+			f2 = PAT.RinF[0][ii];
+			for(j=0; j<nin; j++)
+				{
+				tmpf = f1[j]; f1[j] = f2[j]; f2[j] = tmpf;
+				}
+			}
+		p1 = PAT.Rans[0][i];
+		p2 = PAT.Rans[0][ii];
+		for(j=0; j<nout; j++)
+			{
+			tmp = p1[j]; p1[j] = p2[j]; p2[j] = tmp;
+			}
+		tmp = PAT.Pond[0][i];
+		PAT.Pond[0][i] = PAT.Pond[0][ii];
+		PAT.Pond[0][ii] = tmp;
+		}
+}
+
+
 /***********************************************************/
 /* MLP_Rand                                                */
 /*                                                         */
@@ -3049,6 +3859,34 @@ int LoadWeights(char *filename, int *iepoch)
 }
 
 
+/***********************************************************/
+/* AllocPatArrays                                          */
+/*                                                         */
+/* allocate the per file (learn, test) pattern arrays      */
+/*                                                         */
+/* return value (int) = error code: 0 = no error           */
+/*                               -111 = no memory          */
+/***********************************************************/   
+
+static int AllocPatArrays()
+{
+	ExamplesMemory=1;
+	PAT.Pond = (type_pat **) malloc(2*sizeof(dbl*));
+	PAT.Rin = (type_pat***) malloc(2*sizeof(type_pat**));
+	PAT.RinF = (float***) malloc(2*sizeof(float**));
+	PAT.Rans = (type_pat***) malloc(2*sizeof(type_pat**));
+	PAT.vRin = (type_pat**) malloc(2*sizeof(type_pat*));
+	PAT.vRinF = (float**) malloc(2*sizeof(float*));
+	if(PAT.Pond == 0 || PAT.Rin == 0 || PAT.RinF == 0
+	   || PAT.Rans == 0 || PAT.vRin == 0
+	   || PAT.vRinF == 0) return -111; 
+	PAT.RinF[0] = PAT.RinF[1] = 0;
+	PAT.vRin[0] = PAT.vRin[1] = 0;
+	PAT.vRinF[0] = PAT.vRinF[1] = 0;
+	return 0;
+}
+
+
 /***********************************************************/
 /* AllocPatterns                                           */
 /*                                                         */
@@ -3063,6 +3901,8 @@ int LoadWeights(char *filename, int *iepoch)
 /*                                                         */
 /* return value (int) = error code: 0 = no error	   */
 /*                                  1 = wrong file number  */
+/*                                  2 = cannot add to      */
+/*                                      external examples  */
 /*				   -111 = no memory        */
 /*                                                         */
 /* Author: J.Schwindling   21-Apr-99                       */
@@ -3077,20 +3917,13 @@ int LoadWeights(char *filename, int *iepoch)
 	int j;
 	type_pat *tmp, *tmp3;
 	type_pat **tmp2;
+	float *tmpf;
 	int ntot;
 	
 	if(ifile>1 || ifile<0) return(1);
 /*	scanf("%d",&j); */
-	if(ExamplesMemory==0) 
-		{
-		ExamplesMemory=1;
-        	PAT.Pond = (type_pat **) malloc(2*sizeof(dbl*));
-	        PAT.Rin = (type_pat***) malloc(2*sizeof(type_pat**));
-	        PAT.Rans = (type_pat***) malloc(2*sizeof(type_pat**));
-		PAT.vRin = (type_pat**) malloc(2*sizeof(type_pat*));
-		if(PAT.Pond == 0 || PAT.Rin == 0
-		   || PAT.Rans == 0 || PAT.vRin == 0) return -111; 
-		} 
+	if(ExamplesMemory==0 && AllocPatArrays()!=0) return -111;
+	if(iadd!=0 && PatMemory[ifile]==2) return 2;
 	
 
 /* if iadd=0, check that memory not already allocated. Otherwise free it */
@@ -3113,14 +3946,36 @@ int LoadWeights(char *filename, int *iepoch)
 	PAT.Rans[ifile] = (type_pat**) malloc(npat*sizeof(type_pat*));
 	if(PAT.Rans[ifile] == 0) return -111;
 
-	PAT.vRin[ifile] = (type_pat *) malloc(npat*(nin+1)*
+	if(PatFloat==0)
+		{
+		PAT.vRinF[ifile] = 0;
+		PAT.RinF[ifile] = 0;
+		PAT.vRin[ifile] = (type_pat *) malloc(npat*(nin+1)*
 						sizeof(type_pat));
-	if(PAT.vRin[ifile] == 0) return -111;
+		if(PAT.vRin[ifile] == 0) return -111;
 						
-	for(j=0; j<npat; j++)
+		for(j=0; j<npat; j++)
+			{
+			PAT.Rin[ifile][j] = &(PAT.vRin[ifile][j*(nin+1)+1]);
+			PAT.vRin[ifile][j*(nin+1)] = 1;
+			}
+		}
+	else
 		{
-		PAT.Rin[ifile][j] = &(PAT.vRin[ifile][j*(nin+1)+1]);
-		PAT.vRin[ifile][j*(nin+1)] = 1;
+/* single precision storage: no double precision rows to point to */
+		PAT.vRin[ifile] = 0;
+		PAT.vRinF[ifile] = (float *) malloc(npat*(nin+1)*
+						sizeof(float));
+		PAT.RinF[ifile] = (float **) malloc(npat*sizeof(float*));
+		if(PAT.vRinF[ifile] == 0 || PAT.RinF[ifile] == 0)
+			return -111;
+						
+		for(j=0; j<npat; j++)
+			{
+			PAT.Rin[ifile][j] = 0;
+			PAT.RinF[ifile][j] = &(PAT.vRinF[ifile][j*(nin+1)+1]);
+			PAT.vRinF[ifile][j*(nin+1)] = 1;
+			}
 		}
 	for(j=0; j<npat; j++)
 		{
@@ -3168,6 +4023,8 @@ int LoadWeights(char *filename, int *iepoch)
 	if(PatMemory[ifile]==1) free(PAT.Rin[ifile]);
 	PAT.Rin[ifile] = tmp2;	*/
 	
+	if(PatFloat==0)
+	{
 	tmp3 = (type_pat *) malloc(ntot*(nin+1)*sizeof(type_pat));
 	if(tmp3 == 0) return -111;
 	
@@ -3177,11 +4034,35 @@ int LoadWeights(char *filename, int *iepoch)
 		}
 	if(PatMemory[ifile]==1) free(PAT.vRin[ifile]);
 	PAT.vRin[ifile] = tmp3;
+	free(PAT.Rin[ifile]);
+	PAT.Rin[ifile] = (type_pat**) malloc(ntot*sizeof(type_pat*));
+	if(PAT.Rin[ifile] == 0) return -111;
 	for(j=0; j<ntot; j++)
 		{
 		PAT.Rin[ifile][j] = &(PAT.vRin[ifile][j*(nin+1)+1]);
 		PAT.vRin[ifile][j*(nin+1)] = 1;
 		}
+	}
+	else
+	{
+	tmpf = (float *) malloc(ntot*(nin+1)*sizeof(float));
+	if(tmpf == 0) return -111;
+	
+	for(j=0; j<PAT.Npat[ifile]*(nin+1); j++)
+		{
+		tmpf[j] = PAT.vRinF[ifile][j];
+		}
+	if(PatMemory[ifile]==1) free(PAT.vRinF[ifile]);
+	PAT.vRinF[ifile] = tmpf;
+	free(PAT.RinF[ifile]);
+	PAT.RinF[ifile] = (float**) malloc(ntot*sizeof(float*));
+	if(PAT.RinF[ifile] == 0) return -111;
+	for(j=0; j<ntot; j++)
+		{
+		PAT.RinF[ifile][j] = &(PAT.vRinF[ifile][j*(nin+1)+1]);
+		PAT.vRinF[ifile][j*(nin+1)] = 1;
+		}
+	}
 		
 	tmp2 = (type_pat **) malloc(ntot*sizeof(type_pat*));
 	if(tmp2 == 0) return -111;		
@@ -3208,6 +4089,11 @@ int LoadWeights(char *filename, int *iepoch)
 		for(j=0; j<ntot; j++) ExamplesIndex[j] = j;
 		}
 	}
+
+/* row buffer for MLP_PatRows */
+	free(PatBuf);
+	PatBuf = (type_pat *) malloc(2*(nin+1)*sizeof(type_pat));
+	if(PatBuf == 0) return -111;
 		
 	return 0;
 } 
@@ -3217,6 +4103,7 @@ int LoadWeights(char *filename, int *iepoch)
 /* FreePatterns                                            */
 /*                                                         */
 /* frees memory for the examples                           */
+/* (only the tables for examples set by MLP_SetPatterns)   */
 /*                                                         */
 /* input :	int ifile = file number (0 or 1)           */
 /*                                                         */
@@ -3236,14 +4123,19 @@ int LoadWeights(char *filename, int *iepoch)
 	if(PatMemory[ifile]==0) return 2;
 	
 	free(PAT.Pond[ifile]);
-	for(i=0; i<PAT.Npat[ifile]; i++)
+	if(PatMemory[ifile]==1) for(i=0; i<PAT.Npat[ifile]; i++)
 		{
 /*		free(PAT.Rin[ifile][i]); */
 		free(PAT.Rans[ifile][i]); 
 		}
 	free(PAT.Rin[ifile]);
+	free(PAT.RinF[ifile]);
 	free(PAT.Rans[ifile]);
 	free(PAT.vRin[ifile]);
+	free(PAT.vRinF[ifile]);
+	PAT.RinF[ifile] = 0;
+	PAT.vRin[ifile] = 0;
+	PAT.vRinF[ifile] = 0;
 	PatMemory[ifile] = 0;
 	PAT.Npat[ifile] = 0;
 	
@@ -3251,6 +4143,64 @@ int LoadWeights(char *filename, int *iepoch)
 }		
 
 
+/***********************************************************/
+/* MLP_SetPatterns                                         */
+/*                                                         */
+/* use examples stored outside mlpfit (e.g. filled in      */
+/* chunks while reading the input data) without copying:   */
+/* the pattern tables are taken over and released by       */
+/* FreePatterns, the rows they point to are not            */
+/*                                                         */
+/* input :	int ifile = file number (0 or 1)           */
+/*		int npat = number of examples              */
+/*		type_pat **rin = input rows (PatFloat==0)  */
+/*		float **rinf = input rows (PatFloat!=0)    */
+/*		type_pat **rans = answers                  */
+/*		type_pat *pond = example weights           */
+/*                                                         */
+/* each input row is preceded by a constant 1 (rin[i][-1]) */
+/* tables are malloc'ed, the unused row table may be 0     */
+/*                                                         */
+/* return value (int) = error code: 0 = no error           */
+/*                                  1 = wrong file number  */
+/*                               -111 = no memory          */
+/***********************************************************/   
+
+int MLP_SetPatterns(int ifile, int npat, type_pat **rin, float **rinf,
+		    type_pat **rans, type_pat *pond)
+{
+	int j, nin = NET.Nneur[0];
+
+	if(ifile>1 || ifile<0) return 1;
+	if(ExamplesMemory==0 && AllocPatArrays()!=0) return -111;
+	if(PatMemory[ifile]!=0) FreePatterns(ifile);
+
+	PatMemory[ifile] = 2;
+	PAT.Npat[ifile] = npat;
+	PAT.Pond[ifile] = pond;
+	PAT.Rin[ifile] = rin;
+	PAT.RinF[ifile] = rinf;
+	PAT.Rans[ifile] = rans;
+
+	if(ifile==0)
+		{
+		free(ExamplesIndex);
+		ExamplesIndex = (int *) malloc(npat*sizeof(int));
+		if(ExamplesIndex == 0) return -111;
+		for(j=0; j<npat; j++) ExamplesIndex[j] = j;
+		}
+
+	free(PatBuf);
+	PatBuf = (type_pat *) malloc(2*(nin+1)*sizeof(type_pat));
+	if(PatBuf == 0) return -111;
+
+/* block buffers sized for the new patterns at the next pass */
+	MLP_FreeBatch();
+
+	return 0;
+}
+
+
 /***********************************************************/
 /* MLP_StatInputs                                          */
 /*                                                         */
@@ -3527,6 +4477,8 @@ int AllocNetwork(int Nlayer, int *Neurons)
 void FreeNetwork()
 {
 	int i, j;
+
+	MLP_FreeBatch();
 	for(i=1; i<NET.Nlayer; i++)
 		{
 		for(j=0; j<NET.Nneur[i]; j++)
@@ -3660,6 +4612,85 @@ int MLP_SetNet(int *nl, int *nn)
 }
 
 
+/***********************************************************/
+/* MLP_MVKernel                                            */
+/*                                                         */
+/* vectorised Matrix-Vector product shared by the kernels  */
+/* below, 4 lines of the matrix are processed at once,     */
+/* each one in blocks of MLP_VLEN columns                  */
+/* r[j] = (bias ? M[j][0] : 0) + Sum_i M[j][i+bias] v[i]   */
+/*                                                         */
+/* inputs:     dbl *M = matrix (n lines, ld columns)       */
+/*	       dbl *v = vector (dimension m)       	   */
+/*	       dbl *r = resulting vector (dimension n) 	   */
+/*	       int n  					   */
+/*	       int m  					   */
+/*	       int ld = distance between two lines of M	   */
+/*	       int bias = 1 if M[j][0] is a bias term	   */
+/***********************************************************/
+
+static inline __attribute__((always_inline))
+void MLP_MVKernel(const dbl *M, const dbl *v, dbl *r, int n, int m,
+		  int ld, int bias)
+{
+	int i, j;
+	int mv = m - m % MLP_VLEN;
+	const mlp_vdbl zero = { 0 };
+	mlp_vdbl a1, a2, a3, a4, c, w;
+	dbl s1, s2, s3, s4, d;
+	const dbl *pM1, *pM2, *pM3, *pM4;
+
+	for(i=0; i<n-3; i+=4)
+		{
+		pM1 = &(M[i*ld+bias]);
+		pM2 = pM1 + ld;
+		pM3 = pM2 + ld;
+		pM4 = pM3 + ld;
+		a1 = zero; a2 = zero; a3 = zero; a4 = zero;
+		for(j=0; j<mv; j+=MLP_VLEN)
+			{
+			MLP_VLOAD(c, v+j);
+			MLP_VLOAD(w, pM1+j); a1 += w * c;
+			MLP_VLOAD(w, pM2+j); a2 += w * c;
+			MLP_VLOAD(w, pM3+j); a3 += w * c;
+			MLP_VLOAD(w, pM4+j); a4 += w * c;
+			}
+		s1 = MLP_VSum(&a1); s2 = MLP_VSum(&a2);
+		s3 = MLP_VSum(&a3); s4 = MLP_VSum(&a4);
+		for(j=mv; j<m; j++)
+			{
+			d = v[j];
+			s1 += pM1[j] * d;
+			s2 += pM2[j] * d;
+			s3 += pM3[j] * d;
+			s4 += pM4[j] * d;
+			}
+		if(bias)
+			{
+			s1 += *(pM1-1); s2 += *(pM2-1);
+			s3 += *(pM3-1); s4 += *(pM4-1);
+			}
+		r[i] = s1; r[i+1] = s2; r[i+2] = s3; r[i+3] = s4;
+		}
+	for(i=i; i<n; i++)
+		{
+		pM1 = &(M[i*ld+bias]);
+		a1 = zero;
+		for(j=0; j<mv; j+=MLP_VLEN)
+			{
+			MLP_VLOAD(c, v+j);
+			MLP_VLOAD(w, pM1+j); a1 += w * c;
+			}
+		s1 = MLP_VSum(&a1);
+		for(j=mv; j<m; j++)
+			s1 += pM1[j] * v[j];
+		if(bias)
+			s1 += *(pM1-1);
+		r[i] = s1;
+		}
+}
+
+
 /***********************************************************/
 /* MLP_MatrixVectorBias                                    */
 /*                                                         */
@@ -3673,58 +4704,13 @@ int MLP_SetNet(int *nl, int *nn)
 /*	       int m  					   */ 
 /*                                                         */
 /* Author: J.Schwindling   24-Jan-00                       */
+/* vectorised with runtime instruction set selection       */
 /***********************************************************/
    
+MLP_MULTIVERSION
 void MLP_MatrixVectorBias(dbl *M, dbl *v, dbl *r, int n, int m)
 {
-	int i,j;
-	register dbl a1, a2, a3, a4, c, d;
-	dbl *pM1 = M;
-	dbl *pM2 = &(M[m+1]);
-	dbl *pM3 = &(M[2*(m+1)]);
-	dbl *pM4 = &(M[3*(m+1)]);
-	dbl *pr = r;
-	int mp1 = m+1;
-	
-	for(i=0; i<n-3; 
-		i+=4, pM1 += 3*mp1, pM2 += 3*mp1, pM3 += 3*mp1, pM4 += 3*mp1, 
-		pr+=4)
-		{
-		a1 = *pM1;
-		a2 = *pM2;
-		a3 = *pM3;
-		a4 = *pM4;
-		pM1++; pM2++; pM3++; pM4++;
-		for(j=0; j<m-1; j+=2, pM1+=2, pM2+=2, pM3+=2, pM4+=2) 
-			{
-			c = v[j];
-			d = v[j+1];
-			a1 = a1 + *pM1 * c + *(pM1+1) * d;
-			a2 = a2 + *pM2 * c + *(pM2+1) * d; 
-			a3 = a3 + *pM3 * c + *(pM3+1) * d;
-			a4 = a4 + *pM4 * c + *(pM4+1) * d; 
-			}
-		for(j=j; j<m; j++, pM1++, pM2++, pM3++, pM4++)
-			{
-			c = v[j];
-			a1 = a1 + *pM1 * c;
-			a2 = a2 + *pM2 * c; 
-			a3 = a3 + *pM3 * c;
-			a4 = a4 + *pM4 * c; 
-			}	
-		*pr = a1; *(pr+1) = a2; *(pr+2) = a3; *(pr+3) = a4;
-		}
-	for(i=i; i<n; i++)
-		{
-		pM1 = &(M[i*(m+1)]);
-		a1 = *pM1;
-		pM1++;
-		for(j=0; j<m; j++, pM1++)
-			{
-			a1 = a1 + *pM1 * v[j];
-			}
-		r[i] = a1;	
-		}	
+	MLP_MVKernel(M, v, r, n, m, m+1, 1);
 }
 /***********************************************************/
 /* MLP_MatrixVector 	                                   */
@@ -3739,56 +4725,13 @@ void MLP_MatrixVectorBias(dbl *M, dbl *v, dbl *r, int n, int m)
 /*	       int m  					   */ 
 /*                                                         */
 /* Author: J.Schwindling   24-Jan-00                       */
+/* vectorised with runtime instruction set selection       */
 /***********************************************************/
    
+MLP_MULTIVERSION
 void MLP_MatrixVector(dbl *M, type_pat *v, dbl *r, int n, int m)
 {
-	int i,j;
-	register dbl a1, a2, a3, a4, c, d;
-	dbl *pM1 = M;
-	dbl *pM2 = &(M[m]);
-	dbl *pM3 = &(M[2*m]);
-	dbl *pM4 = &(M[3*m]);
-	dbl *pr = r;
-	int mp1 = m;
-	
-	for(i=0; i<n-3; 
-		i+=4, pM1 += 3*mp1, pM2 += 3*mp1, pM3 += 3*mp1, pM4 += 3*mp1, 
-		pr+=4)
-		{
-		a1 = 0;
-		a2 = 0;
-		a3 = 0;
-		a4 = 0;
-		for(j=0; j<m-1; j+=2, pM1+=2, pM2+=2, pM3+=2, pM4+=2) 
-			{
-			c = v[j];
-			d = v[j+1];
-			a1 = a1 + *pM1 * c + *(pM1+1) * d;
-			a2 = a2 + *pM2 * c + *(pM2+1) * d; 
-			a3 = a3 + *pM3 * c + *(pM3+1) * d;
-			a4 = a4 + *pM4 * c + *(pM4+1) * d; 
-			}
-		for(j=j; j<m; j++, pM1++, pM2++, pM3++, pM4++)
-			{
-			c = v[j];
-			a1 = a1 + *pM1 * c;
-			a2 = a2 + *pM2 * c; 
-			a3 = a3 + *pM3 * c;
-			a4 = a4 + *pM4 * c; 
-			}	
-		*pr = a1; *(pr+1) = a2; *(pr+2) = a3; *(pr+3) = a4;
-		}
-	for(i=i; i<n; i++)
-		{
-		pM1 = &(M[i*m]);
-		a1 = 0;
-		for(j=0; j<m; j++, pM1++)
-			{
-			a1 = a1 + *pM1 * v[j];
-			}
-		r[i] = a1;	
-		}	
+	MLP_MVKernel(M, v, r, n, m, m, 0);
 }
 
 
@@ -3808,58 +4751,164 @@ void MLP_MatrixVector(dbl *M, type_pat *v, dbl *r, int n, int m)
 /*	       int NbOffs				   */ 
 /*                                                         */
 /* Author: J.Schwindling   24-Jan-00                       */
+/* vectorised with runtime instruction set selection       */
 /***********************************************************/
    
+MLP_MULTIVERSION
 void MLP_MM2rows(dbl* c, type_pat* a, dbl* b,
              int Ni, int Nj, int Nk, int NaOffs, int NbOffs)
 {
-//int i,j,k;
-int j,k;
-dbl s00,s01,s10,s11;
-type_pat *pa0,*pa1;
-dbl *pb0,*pb1,*pc0,*pc1;
-
-  for (j=0; j<=Nj-2; j+=2)
-   {
-    pc0 = c+j;
-    pc1 = c+j+Nj;
-    s00 = 0.0; s01 = 0.0; s10 = 0.0; s11 = 0.0;
-
-    for (k=0,pb0=b+k+NbOffs*j,
-             pb1=b+k+NbOffs*(j+1),
-             pa0=a+k,
-             pa1=a+k+NaOffs;
-         k<Nk;
-         k++,pa0++,
-             pa1++,
-             pb0++,
-             pb1++)
-     {
-      s00 += (*pa0)*(*pb0);
-      s01 += (*pa0)*(*pb1);
-      s10 += (*pa1)*(*pb0);
-      s11 += (*pa1)*(*pb1);
-     }
-    *pc0 = s00; *(pc0+1) = s01; *pc1 = s10; *(pc1+1) = s11;
-   }
-  for (j=j; j<Nj; j++)
-   {
-    pc0 = c+j;
-    pc1 = c+j+Nj;
-    s00 = 0.0; s10 = 0.0;
-    for (k=0,pb0=b+k+NbOffs*j,
-             pa0=a+k,
-             pa1=a+k+NaOffs;
-         k<Nk;
-         k++,pa0++,
-             pa1++,
-             pb0++)
-     {
-      s00 += (*pa0)*(*pb0);
-      s10 += (*pa1)*(*pb0);
-     }
-    *pc0 = s00; *pc1 = s10;
-   }
+	MLP_MVKernel(b, a, c, Nj, Nk, NbOffs, 0);
+	MLP_MVKernel(b, a+NaOffs, c+Nj, Nj, Nk, NbOffs, 0);
+}
+
+/***********************************************************/
+/* MLP_GemmRows                                            */
+/*                                                         */
+/* nr (1 to 4) lines of MLP_GemmAcc, the corresponding     */
+/* part of C being kept in registers by blocks of MLP_VLEN */
+/* columns while running over k                            */
+/***********************************************************/
+
+static inline __attribute__((always_inline))
+void MLP_GemmRows(int nr, int m, int K, const dbl *A, int ais, int aks,
+		  const dbl *B, int ldb, dbl *C, int ldc, int acc)
+{
+	int j, k, r, mv = m - m % MLP_VLEN;
+	const mlp_vdbl zero = { 0 };
+	mlp_vdbl c[4], b;
+	dbl s[4], a;
+
+	for(j=0; j<mv; j+=MLP_VLEN)
+		{
+		for(r=0; r<nr; r++)
+			if(acc) MLP_VLOAD(c[r], C+r*ldc+j);
+			else c[r] = zero;
+		for(k=0; k<K; k++)
+			{
+			MLP_VLOAD(b, B+k*ldb+j);
+			for(r=0; r<nr; r++)
+				c[r] += A[r*ais+k*aks] * b;
+			}
+		for(r=0; r<nr; r++)
+			MLP_VSTORE(C+r*ldc+j, c[r]);
+		}
+	for(j=mv; j<m; j++)
+		{
+		for(r=0; r<nr; r++)
+			s[r] = acc ? C[r*ldc+j] : 0;
+		for(k=0; k<K; k++)
+			{
+			a = B[k*ldb+j];
+			for(r=0; r<nr; r++)
+				s[r] += A[r*ais+k*aks] * a;
+			}
+		for(r=0; r<nr; r++)
+			C[r*ldc+j] = s[r];
+		}
+}
+
+
+/***********************************************************/
+/* MLP_GemmAcc                                             */
+/*                                                         */
+/* computes a Matrix-Matrix product                        */
+/* C[i][j] = (acc ? C[i][j] : 0) + Sum_k A(i,k) B[k][j]    */
+/* where A(i,k) = A[i*ais + k*aks], so that A can be used  */
+/* either directly or transposed                           */
+/*                                                         */
+/* inputs:     int n, m, K = dimensions                    */
+/*	       dbl *A = first matrix (n * K)       	   */
+/*	       int ais, aks = strides of A		   */
+/*	       dbl *B = second matrix (K lines, ldb columns)*/
+/*	       dbl *C = resulting matrix (n lines, ldc col.)*/
+/*	       int acc = 1: add to C, 0: overwrite C	   */
+/***********************************************************/
+
+MLP_MULTIVERSION
+void MLP_GemmAcc(int n, int m, int K, dbl *A, int ais, int aks,
+		 dbl *B, int ldb, dbl *C, int ldc, int acc)
+{
+	int i;
+
+	for(i=0; i<n-3; i+=4)
+		MLP_GemmRows(4, m, K, A+i*ais, ais, aks, B, ldb,
+			     C+i*ldc, ldc, acc);
+	for(i=i; i<n; i++)
+		MLP_GemmRows(1, m, K, A+i*ais, ais, aks, B, ldb,
+			     C+i*ldc, ldc, acc);
+}
+
+/***********************************************************/
+/* MLP_GemmRowsF                                           */
+/*                                                         */
+/* nr (1 to 4) lines of MLP_GemmF                          */
+/***********************************************************/
+
+static inline __attribute__((always_inline))
+void MLP_GemmRowsF(int nr, int m, int K, const float *A, int lda,
+		   const float *B, int ldb, dbl *C, int ldc)
+{
+	int j, k, r, l, mv = m - m % MLP_VLENF;
+	const mlp_vflt zero = { 0 };
+	mlp_vflt c[4], b;
+	float s[4], a;
+
+	for(j=0; j<mv; j+=MLP_VLENF)
+		{
+		for(r=0; r<nr; r++)
+			c[r] = zero;
+		for(k=0; k<K; k++)
+			{
+			MLP_VLOADF(b, B+k*ldb+j);
+			for(r=0; r<nr; r++)
+				c[r] += A[r*lda+k] * b;
+			}
+		for(r=0; r<nr; r++)
+			for(l=0; l<MLP_VLENF; l++)
+				C[r*ldc+j+l] = c[r][l];
+		}
+	for(j=mv; j<m; j++)
+		{
+		for(r=0; r<nr; r++)
+			s[r] = 0;
+		for(k=0; k<K; k++)
+			{
+			a = B[k*ldb+j];
+			for(r=0; r<nr; r++)
+				s[r] += A[r*lda+k] * a;
+			}
+		for(r=0; r<nr; r++)
+			C[r*ldc+j] = s[r];
+		}
+}
+
+
+/***********************************************************/
+/* MLP_GemmF                                               */
+/*                                                         */
+/* single precision Matrix-Matrix product, stored in       */
+/* double precision: C[i][j] = Sum_k A[i][k] B[k][j]       */
+/* (twice as many values per vector as MLP_GemmAcc)        */
+/*                                                         */
+/* inputs:     int n, m, K = dimensions                    */
+/*	       float *A = first matrix (n lines, lda col.) */
+/*	       float *B = second matrix (K lines, ldb col.)*/
+/*	       dbl *C = resulting matrix (n lines, ldc col.)*/
+/***********************************************************/
+
+MLP_MULTIVERSION
+void MLP_GemmF(int n, int m, int K, float *A, int lda,
+	       float *B, int ldb, dbl *C, int ldc)
+{
+	int i;
+
+	for(i=0; i<n-3; i+=4)
+		MLP_GemmRowsF(4, m, K, A+i*lda, lda, B, ldb,
+			      C+i*ldc, ldc);
+	for(i=i; i<n; i++)
+		MLP_GemmRowsF(1, m, K, A+i*lda, lda, B, ldb,
+			      C+i*ldc, ldc);
 }
 
 #ifdef __cplusplus
@@ -40,6 +40,7 @@ extern struct pat_
 	int Npat[2], Iponde, Nin, Nout;
 	type_pat ***Rin, ***Rans, **Pond;
 	type_pat **vRin; 
+	float ***RinF, **vRinF;
 	dbl Ponds[10];
 } pat_ MLP_HIDDEN;
 #define PAT pat_
@@ -71,6 +72,15 @@ extern int NetMemory MLP_HIDDEN;
 extern float MLPfitVersion MLP_HIDDEN;
 extern dbl LastAlpha MLP_HIDDEN;
 extern int NLineSearchFail MLP_HIDDEN;
+extern int NThreads MLP_HIDDEN;
+extern int NBatch MLP_HIDDEN;
+extern int PatFloat MLP_HIDDEN;
+extern int ShuffleBlock MLP_HIDDEN;
+extern int ShuffleReorder MLP_HIDDEN;
+extern type_pat *PatBuf MLP_HIDDEN;
+/* called with the patterns about to be read in ascending order */
+extern void (*MLP_PatternPrefetch)(int ifile, int ipat,
+					int npat) MLP_HIDDEN;
 
 extern dbl ***dir MLP_HIDDEN;
 extern dbl *delta MLP_HIDDEN;
@@ -83,10 +93,21 @@ extern dbl **Hessian MLP_HIDDEN;
 extern void 	MLP_Out(type_pat *rrin, dbl *rrout) MLP_HIDDEN;
 extern void 	MLP_Out2(type_pat *rrin) MLP_HIDDEN;
 extern void 	MLP_Out_T(type_pat *rrin) MLP_HIDDEN;
+extern type_pat	*MLP_PatRows(int ifile, int ipat, int n,
+			type_pat *buf) MLP_HIDDEN;
+extern float	*MLP_PatRowsF(int ifile, int ipat, int n,
+			float *buf) MLP_HIDDEN;
+extern void 	MLP_OutBuf(dbl **vweights, type_pat *rrin,
+			dbl **outn, dbl **deriv1) MLP_HIDDEN;
 extern dbl  	MLP_Test(int ifile, int regul) MLP_HIDDEN;
 extern dbl 	MLP_Epoch(int iepoch, dbl *alpmin, int *ntest) MLP_HIDDEN;
 extern int 	MLP_Train(int *ipat,dbl *err) MLP_HIDDEN;
 extern dbl 	MLP_Stochastic() MLP_HIDDEN;
+extern dbl 	MLP_StochasticParallel(int nthreads) MLP_HIDDEN;
+extern int 	MLP_BatchSize() MLP_HIDDEN;
+extern dbl 	MLP_TrainBatch() MLP_HIDDEN;
+extern dbl 	MLP_TestBatch(int ifile) MLP_HIDDEN;
+extern void	MLP_FreeBatch() MLP_HIDDEN;
 	
 extern int 	StochStep() MLP_HIDDEN;
 
@@ -120,6 +141,10 @@ extern int	FixedStep(dbl alpha) MLP_HIDDEN;
 
 extern void     EtaDecay() MLP_HIDDEN;
 extern int 	ShuffleExamples(int n, int *index) MLP_HIDDEN;
+extern int 	ShuffleBlocks(int n, int *index, int nblock) MLP_HIDDEN;
+extern int 	MLP_ShuffleBlockSize() MLP_HIDDEN;
+extern void 	MLP_ShuffleEpoch() MLP_HIDDEN;
+extern void 	MLP_ReorderPatterns() MLP_HIDDEN;
 extern double 	MLP_Rand(dbl min, dbl max) MLP_HIDDEN;
 extern void	InitWeights() MLP_HIDDEN;
 extern int	NormalizeInputs() MLP_HIDDEN;
@@ -143,6 +168,9 @@ extern int    	MLP_PrFFun(char *filename) MLP_HIDDEN;
 extern int    	MLP_PrCFun(char *filename) MLP_HIDDEN;
 extern int 	AllocPatterns(int ifile, int npat, int nin, int nout, int iadd) MLP_HIDDEN;
 extern int 	FreePatterns(int ifile) MLP_HIDDEN;
+extern int 	MLP_SetPatterns(int ifile, int npat, type_pat **rin,
+			float **rinf, type_pat **rans,
+			type_pat *pond) MLP_HIDDEN;
 extern void 	AllocWeights() MLP_HIDDEN;
 extern void	FreeWeights() MLP_HIDDEN;
 extern int 	AllocNetwork(int Nlayer, int *Neurons) MLP_HIDDEN;
@@ -156,6 +184,10 @@ extern void 	MLP_MatrixVector(dbl *M, type_pat *v, dbl *r, int n,
 				int m) MLP_HIDDEN;
 extern void 	MLP_MatrixVectorBias(dbl *M, dbl *v, dbl *r, int n,
 				 int m) MLP_HIDDEN;
+extern void 	MLP_GemmAcc(int n, int m, int K, dbl *A, int ais, int aks,
+			dbl *B, int ldb, dbl *C, int ldc, int acc) MLP_HIDDEN;
+extern void 	MLP_GemmF(int n, int m, int K, float *A, int lda,
+			float *B, int ldb, dbl *C, int ldc) MLP_HIDDEN;
 
 #ifdef __cplusplus
 } // extern "C"
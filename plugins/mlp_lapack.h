@@ -5,6 +5,47 @@
 #	define MLP_HIDDEN __attribute__((visibility("hidden")))
 #endif
 
+/* The bundled routines get private names, so that they can neither
+   clash with nor be interposed by a system BLAS / LAPACK (whose
+   integers are not the f2c long int) linked into the same process. */
+#define dgels_	mlp_dgels_
+#define dnrm2_	mlp_dnrm2_
+#define dgelq2_	mlp_dgelq2_
+#define dgelqf_	mlp_dgelqf_
+#define dgeqr2_	mlp_dgeqr2_
+#define dgeqrf_	mlp_dgeqrf_
+#define dlabad_	mlp_dlabad_
+#define dlamch_	mlp_dlamch_
+#define dlamc1_	mlp_dlamc1_
+#define dlamc2_	mlp_dlamc2_
+#define dlamc3_	mlp_dlamc3_
+#define dlamc4_	mlp_dlamc4_
+#define dlamc5_	mlp_dlamc5_
+#define dlange_	mlp_dlange_
+#define dlapy2_	mlp_dlapy2_
+#define dlarf_	mlp_dlarf_
+#define dlarfb_	mlp_dlarfb_
+#define dlarfg_	mlp_dlarfg_
+#define dlarft_	mlp_dlarft_
+#define dlascl_	mlp_dlascl_
+#define dlaset_	mlp_dlaset_
+#define dlassq_	mlp_dlassq_
+#define dorm2r_	mlp_dorm2r_
+#define dorml2_	mlp_dorml2_
+#define dormlq_	mlp_dormlq_
+#define dormqr_	mlp_dormqr_
+#define ilaenv_	mlp_ilaenv_
+#define lsame_	mlp_lsame_
+#define xerbla_	mlp_xerbla_
+#define dcopy_	mlp_dcopy_
+#define dgemm_	mlp_dgemm_
+#define dgemv_	mlp_dgemv_
+#define dger_	mlp_dger_
+#define dscal_	mlp_dscal_
+#define dtrmm_	mlp_dtrmm_
+#define dtrmv_	mlp_dtrmv_
+#define dtrsm_	mlp_dtrsm_
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -0,0 +1,60 @@
+#ifndef __private_mlp_simd_h
+#define __private_mlp_simd_h
+
+#include <string.h>
+
+#include "mlp_gen.h"
+
+/*
+ * Helpers for the vectorised mlpfit kernels.
+ *
+ * The kernels are written with the GCC generic vector extension on
+ * blocks of MLP_VLEN doubles.  Functions tagged with MLP_MULTIVERSION
+ * are compiled once per supported instruction set (AVX-512, AVX2 and
+ * the SSE2 baseline of x86-64) and the best version is selected at
+ * load time from the CPU features, so the same plugin runs everywhere.
+ */
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 6 && \
+    defined(__x86_64__) && defined(__ELF__)
+#	define MLP_MULTIVERSION \
+		__attribute__((target_clones("avx512f","avx2","default")))
+#else
+#	define MLP_MULTIVERSION
+#endif
+
+#define MLP_VLEN 8
+#define MLP_VLENF (2 * MLP_VLEN)
+
+typedef dbl mlp_vdbl __attribute__((vector_size(MLP_VLEN * sizeof(dbl))));
+typedef long long mlp_vint __attribute__((vector_size(MLP_VLEN *
+                                                      sizeof(long long))));
+typedef unsigned long long mlp_vuint __attribute__((vector_size(MLP_VLEN *
+                                           sizeof(unsigned long long))));
+typedef float mlp_vflt __attribute__((vector_size(MLP_VLENF * sizeof(float))));
+
+/* unaligned loads and stores, compile to a single vector move */
+#define MLP_VLOAD(v, p)		memcpy(&(v), (p), sizeof(mlp_vdbl))
+#define MLP_VSTORE(p, v)	memcpy((p), &(v), sizeof(mlp_vdbl))
+#define MLP_VLOADF(v, p)	memcpy(&(v), (p), sizeof(mlp_vflt))
+
+/* horizontal sum, by pairwise folding of the vector halves */
+static inline __attribute__((always_inline)) dbl MLP_VSum(const mlp_vdbl *v)
+{
+#if defined(__clang__)
+	mlp_vdbl h = *v + __builtin_shufflevector(*v, *v,
+					4, 5, 6, 7, 0, 1, 2, 3);
+	h += __builtin_shufflevector(h, h, 2, 3, 0, 1, 6, 7, 4, 5);
+	h += __builtin_shufflevector(h, h, 1, 0, 3, 2, 5, 4, 7, 6);
+#else
+	const mlp_vint fold4 = { 4, 5, 6, 7, 0, 1, 2, 3 };
+	const mlp_vint fold2 = { 2, 3, 0, 1, 6, 7, 4, 5 };
+	const mlp_vint fold1 = { 1, 0, 3, 2, 5, 4, 7, 6 };
+	mlp_vdbl h = *v + __builtin_shuffle(*v, fold4);
+	h += __builtin_shuffle(h, fold2);
+	h += __builtin_shuffle(h, fold1);
+#endif
+	return h[0];
+}
+
+#endif // __private_mlp_simd_h
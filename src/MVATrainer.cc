@@ -12,6 +12,9 @@
 #include <map>
 #include <set>
 
+#include <sys/time.h>
+#include <sys/resource.h>
+
 #include <xercesc/dom/DOM.hpp>
 
 #include <TRandom.h>
@@ -402,6 +405,29 @@ static bool isMagic(AtomicId id)
 	       id == kOutputId;
 }
 
+static double wallClock()
+{
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return tv.tv_sec + 1.0e-6 * tv.tv_usec;
+}
+
+// CPU time of this process and its terminated children (e.g. workers)
+static double cpuClock()
+{
+	double result = 0.0;
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+		result += usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+		          1.0e-6 * (usage.ru_utime.tv_usec +
+		                    usage.ru_stime.tv_usec);
+	if (getrusage(RUSAGE_CHILDREN, &usage) == 0)
+		result += usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+		          1.0e-6 * (usage.ru_utime.tv_usec +
+		                    usage.ru_stime.tv_usec);
+	return result;
+}
+
 static std::string escape(const std::string &in)
 {
 	std::string result("'");
@@ -423,7 +449,10 @@ MVATrainer::MVATrainer(const std::string &fileName, bool useXSLT,
 	const char *styleSheet) :
 	input(0), output(0), name("MVATrainer"),
 	doAutoSave(true), doCleanup(false),
-	doMonitoring(false), randomSeed(65539), crossValidation(0.0)
+	doMonitoring(false), randomSeed(65539), crossValidation(0.0),
+	wallBudget(0.0), cpuBudget(0.0), wallStart(0.0), cpuStart(0.0),
+	passWallStart(-1.0), passCPUStart(-1.0),
+	passWallTime(0.0), passCPUTime(0.0)
 {
 	if (useXSLT) {
 		std::string sheet;
@@ -707,6 +736,42 @@ std::string MVATrainer::trainFileName(const TrainProcessor *proc,
 	                       arg_.c_str(), ext.c_str());
 }
 
+void MVATrainer::setTimeBudget(double wallTime, double cpuTime)
+{
+	wallBudget = wallTime;
+	cpuBudget = cpuTime;
+	wallStart = wallClock();
+	cpuStart = cpuClock();
+}
+
+double MVATrainer::getTimeLeft(const TrainProcessor *proc, bool cpu) const
+{
+	double budget = cpu ? cpuBudget : wallBudget;
+	if (budget <= 0.0)
+		return -1.0;
+
+	double left = budget - (cpu ? cpuClock() - cpuStart
+	                            : wallClock() - wallStart);
+
+	// every other untrained processor needs at least one more pass
+	// over the data, estimated by the most expensive pass so far
+	unsigned int pending = 0;
+	for(std::vector<AtomicId>::const_iterator iter = processors.begin();
+	    iter != processors.end(); ++iter) {
+		std::map<AtomicId, Source*>::const_iterator pos =
+							sources.find(*iter);
+		if (pos != sources.end() && pos->second != proc &&
+		    !pos->second->isTrained())
+			pending++;
+	}
+	left -= pending * (cpu ? passCPUTime : passWallTime);
+
+	// and a little for writing out the calibration
+	left -= 0.02 * budget;
+
+	return left > 0.0 ? left : 0.0;
+}
+
 TrainerMonitoring::Module *MVATrainer::bookMonitor(const std::string &name)
 {
 	if (!doMonitoring)
@@ -1109,6 +1174,15 @@ void MVATrainer::doneTraining(Calibration::MVAComputer *trainCalibration) const
 			<< "Invalid training calibration passed to "
 			   "doneTraining()" << std::endl;
 
+	// cost of the pass over the data, before the processors train
+	if (passWallStart >= 0.0) {
+		passWallTime = std::max(passWallTime,
+		                        wallClock() - passWallStart);
+		passCPUTime = std::max(passCPUTime,
+		                       cpuClock() - passCPUStart);
+		passWallStart = passCPUStart = -1.0;
+	}
+
 	calib->done();
 }
 
@@ -1249,6 +1323,9 @@ Calibration::MVAComputer *MVATrainer::getTrainCalibration() const
 	compute.push_back(0);
 	train.push_back(0);
 
+	passWallStart = wallClock();
+	passCPUStart = cpuClock();
+
 	return makeTrainCalibration(&compute.front(), &train.front());
 }
 
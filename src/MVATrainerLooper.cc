@@ -44,6 +44,8 @@ MVATrainerLooper::Trainer::Trainer(const edm::ParameterSet &params)
 	bool doLoad = params.getUntrackedParameter<bool>("loadState", false);
 	bool doSave = params.getUntrackedParameter<bool>("saveState", false);
 	bool doMonitoring = params.getUntrackedParameter<bool>("monitoring", false);
+	double timeBudget = params.getUntrackedParameter<double>("timeBudget", 0.0);
+	double cpuBudget = params.getUntrackedParameter<double>("cpuBudget", 0.0);
 
 	trainer.reset(new MVATrainer(trainDescription, useXSLT));
 
@@ -53,6 +55,8 @@ MVATrainerLooper::Trainer::Trainer(const edm::ParameterSet &params)
 	trainer->setAutoSave(doSave);
 	trainer->setCleanup(!doSave);
 	trainer->setMonitoring(doMonitoring);
+	if (timeBudget > 0.0 || cpuBudget > 0.0)
+		trainer->setTimeBudget(timeBudget, cpuBudget);
 }
 
 // MVATrainerLooper::MVATrainerContainer implementation
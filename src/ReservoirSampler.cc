@@ -0,0 +1,97 @@
+#include <functional>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+
+#include <TRandom.h>
+
+#include "PhysicsTools/MVATrainer/interface/ReservoirSampler.h"
+
+namespace PhysicsTools {
+
+ReservoirSampler::ReservoirSampler(unsigned int capacity, UInt_t seed) :
+	capacity(capacity), random(seed), skip(0.0), offered(0),
+	candidates(0), offeredWeight(0.0)
+{
+	slots.reserve(capacity);
+	heap.reserve(capacity);
+}
+
+ReservoirSampler::~ReservoirSampler()
+{
+}
+
+// weight to pass until the smallest key is replaced:
+// log(r) / log(smallest key), r uniform in (0, 1]
+void ReservoirSampler::jump()
+{
+	double threshold = heap.front().first;
+	skip = threshold < 0.0 ? std::log(random.Rndm()) / threshold
+	                       : HUGE_VAL;
+}
+
+int ReservoirSampler::offer(double weight)
+{
+	offered++;
+	offeredWeight += weight;
+
+	double w = std::abs(weight);
+	if (!(w > 0.0) || !capacity)
+		return -1;
+
+	candidates++;
+
+	if (slots.size() < capacity) {
+		Slot slot;
+		slot.weight = weight;
+		slot.logKey = std::log(random.Rndm()) / w;
+		slots.push_back(slot);
+
+		heap.push_back(Entry(slot.logKey, slots.size() - 1));
+		std::push_heap(heap.begin(), heap.end(),
+		               std::greater<Entry>());
+
+		if (slots.size() == capacity)
+			jump();
+
+		return slots.size() - 1;
+	}
+
+	skip -= w;
+	if (skip > 0.0)
+		return -1;
+
+	// the key of this event is known to be above the smallest one,
+	// draw it from u^(1/w) in [threshold, 1]
+	double t = std::exp(w * heap.front().first);
+	double logKey = std::log(t + (1.0 - t) * random.Rndm()) / w;
+
+	std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+	unsigned int index = heap.back().second;
+	heap.back() = Entry(logKey, index);
+	std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+
+	slots[index].weight = weight;
+	slots[index].logKey = logKey;
+
+	jump();
+
+	return index;
+}
+
+double ReservoirSampler::getWeight(unsigned int slot) const
+{
+	const Slot &s = slots[slot];
+
+	// nothing was dropped
+	if (candidates <= capacity)
+		return s.weight;
+
+	if (slot == heap.front().second)
+		return 0.0;
+
+	// 1 / P(u^(1/w) > threshold) = 1 / (1 - threshold^w)
+	return s.weight / -std::expm1(std::abs(s.weight) * heap.front().first);
+}
+
+} // namespace PhysicsTools
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <set>
+
+#include <TObjArray.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <TChain.h>
+
+#include "PhysicsTools/MVAComputer/interface/Calibration.h"
+
+#include "PhysicsTools/MVATrainer/interface/TreeBranchSelection.h"
+
+namespace PhysicsTools {
+
+TreeBranchSelection::TreeBranchSelection(TTree *tree) :
+	tree(tree), selectedBytes(0), totalBytes(0), startBytes(0),
+	notify(0)
+{
+}
+
+TreeBranchSelection::~TreeBranchSelection()
+{
+	removeNotify();
+}
+
+Bool_t TreeBranchSelection::FileNotify::Notify()
+{
+	selection->addFile();
+	return next ? next->Notify() : kTRUE;
+}
+
+void TreeBranchSelection::add(const std::string &name)
+{
+	names.insert(name);
+}
+
+void TreeBranchSelection::add(const Calibration::MVAComputer *calib)
+{
+	for(std::vector<Calibration::Variable>::const_iterator iter =
+						calib->inputSet.begin();
+	    iter != calib->inputSet.end(); ++iter)
+		add(iter->name);
+}
+
+// the branch, its sub-branches and the branches holding the sizes
+// of its arrays
+void TreeBranchSelection::select(TBranch *branch)
+{
+	std::string name = branch->GetName();
+	if (std::find(selected.begin(), selected.end(), name) !=
+							selected.end())
+		return;
+
+	tree->SetBranchStatus(name.c_str(), 1);
+	selected.push_back(name);
+
+	TObjArray *leaves = branch->GetListOfLeaves();
+	for(int i = 0; i < leaves->GetEntriesFast(); i++) {
+		TLeaf *count = static_cast<TLeaf*>(
+					leaves->UncheckedAt(i))->GetLeafCount();
+		if (count)
+			select(count->GetBranch());
+	}
+}
+
+// adds the sizes of the tree of the current file, once per file
+void TreeBranchSelection::addFile()
+{
+	TTree *current = tree->GetTree();
+	if (!current || !files.insert(tree->GetTreeNumber()).second)
+		return;
+
+	totalBytes += current->GetZipBytes();
+	for(std::vector<std::string>::const_iterator iter = selected.begin();
+	    iter != selected.end(); ++iter) {
+		TBranch *branch = current->GetBranch(iter->c_str());
+		if (branch)
+			selectedBytes += branch->GetZipBytes("*");
+	}
+}
+
+void TreeBranchSelection::removeNotify()
+{
+	if (!notify)
+		return;
+
+	if (tree->GetNotify() == notify)
+		tree->SetNotify(notify->next);
+	delete notify;
+	notify = 0;
+}
+
+void TreeBranchSelection::apply(Long64_t cacheSize)
+{
+	removeNotify();
+	tree->SetBranchStatus("*", 0);
+	selected.clear();
+	files.clear();
+	selectedBytes = totalBytes = 0;
+
+	for(std::set<std::string>::const_iterator iter = names.begin();
+	    iter != names.end(); ++iter) {
+		TBranch *branch = tree->GetBranch(iter->c_str());
+		if (branch)
+			select(branch);
+	}
+
+	tree->SetCacheSize(cacheSize);
+	for(std::vector<std::string>::const_iterator iter = selected.begin();
+	    iter != selected.end(); ++iter)
+		tree->AddBranchToCache(iter->c_str(), true);
+
+	// a chain tells when it moves on to the next file
+	if (dynamic_cast<TChain*>(tree)) {
+		notify = new FileNotify(this, tree->GetNotify());
+		tree->SetNotify(notify);
+	}
+	addFile();
+
+	startBytes = TFile::GetFileBytesRead();
+}
+
+void TreeBranchSelection::release()
+{
+	removeNotify();
+	tree->SetCacheSize(0);
+	tree->SetBranchStatus("*", 1);
+	selected.clear();
+}
+
+// the counter of TFile covers every file of a chain
+Long64_t TreeBranchSelection::getBytesRead() const
+{
+	return TFile::GetFileBytesRead() - startBytes;
+}
+
+void TreeBranchSelection::report(std::ostream &out) const
+{
+	Long64_t total = getTotalBytes();
+	Long64_t read = getBytesRead();
+
+	out << "Tree " << tree->GetName() << ": read " << selected.size()
+	    << " of " << tree->GetListOfBranches()->GetEntriesFast()
+	    << " branches, " << (read >> 10) << " kB of "
+	    << (total >> 10) << " kB compressed";
+	if (read > 0)
+		out << " (" << ((double)total / read) << " times less)";
+	out << "." << std::endl;
+}
+
+} // namespace PhysicsTools
@@ -0,0 +1,73 @@
+#include <string>
+
+#include <TFile.h>
+#include <TTree.h>
+
+#include <xercesc/dom/DOM.hpp>
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "PhysicsTools/MVATrainer/interface/XMLDocument.h"
+#include "PhysicsTools/MVATrainer/interface/TreeExportOptions.h"
+
+XERCES_CPP_NAMESPACE_USE
+
+namespace PhysicsTools {
+
+// ROOT's defaults: zlib level 1, 32 kB baskets and 30 MB clusters
+TreeExportOptions::TreeExportOptions() :
+	algorithm(1), level(1), basketSize(32000),
+	autoFlush(-30000000), floatStorage(false)
+{
+}
+
+void TreeExportOptions::configure(DOMElement *elem)
+{
+	// ROOT::ECompressionAlgorithm
+	std::string compression = XMLDocument::readAttribute<std::string>(
+						elem, "compression", "zlib");
+	if (compression == "none")
+		algorithm = 0;
+	else if (compression == "zlib")
+		algorithm = 1;
+	else if (compression == "lzma")
+		algorithm = 2;
+	else if (compression == "lz4")
+		algorithm = 4;
+	else
+		throw cms::Exception("TreeExportOptions")
+			<< "Invalid compression \"" << compression << "\", "
+			   "expected \"none\", \"zlib\", \"lzma\" or \"lz4\"."
+			<< std::endl;
+
+	level = XMLDocument::readAttribute<Int_t>(elem, "level", 1);
+	if (level < 1 || level > 9)
+		throw cms::Exception("TreeExportOptions")
+			<< "Compression level has to be between 1 and 9."
+			<< std::endl;
+
+	basketSize = XMLDocument::readAttribute<Int_t>(elem, "basket",
+	                                               basketSize);
+	if (basketSize < 1024)
+		throw cms::Exception("TreeExportOptions")
+			<< "Basket size has to be at least 1024 bytes."
+			<< std::endl;
+
+	// given in bytes, negative for ROOT
+	autoFlush = -XMLDocument::readAttribute<Long64_t>(elem, "autoflush",
+	                                                  -autoFlush);
+
+	floatStorage = XMLDocument::readAttribute<bool>(elem, "float", false);
+}
+
+void TreeExportOptions::apply(TFile *file) const
+{
+	file->SetCompressionSettings(algorithm ? 100 * algorithm + level : 0);
+}
+
+void TreeExportOptions::apply(TTree *tree) const
+{
+	tree->SetAutoFlush(autoFlush);
+}
+
+} // namespace PhysicsTools
@@ -0,0 +1,411 @@
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+#include <errno.h>
+#include <glob.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <TString.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <TChain.h>
+#include <TList.h>
+#include <TKey.h>
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "PhysicsTools/MVATrainer/interface/TreeInputSet.h"
+
+namespace PhysicsTools {
+
+namespace {
+	// result of scanning one file, sent from the workers
+	struct Record {
+		unsigned int	index;
+		char		ok;
+		char		hasTarget;
+		Long64_t	entries;
+		char		treeName[256];
+	};
+}
+
+TreeInputSet::TreeInputSet()
+{
+}
+
+TreeInputSet::~TreeInputSet()
+{
+}
+
+static bool isPattern(const std::string &name)
+{
+	return name.find_first_of("*?[") != std::string::npos &&
+	       name.find("://") == std::string::npos;
+}
+
+static bool isList(const std::string &name)
+{
+	std::string::size_type dot = name.rfind('.');
+	if (dot == std::string::npos)
+		return false;
+	std::string ext = name.substr(dot);
+	return ext == ".list" || ext == ".txt";
+}
+
+static void expand(const std::string &pattern,
+                   std::vector<std::string> &names)
+{
+	if (!isPattern(pattern)) {
+		names.push_back(pattern);
+		return;
+	}
+
+	glob_t result;
+	if (glob(pattern.c_str(), 0, 0, &result) == 0)
+		names.insert(names.end(), result.gl_pathv,
+		             result.gl_pathv + result.gl_pathc);
+	globfree(&result);
+}
+
+bool TreeInputSet::add(const std::string &arg)
+{
+	std::string::size_type pos = arg.find('@');
+
+	std::string treeName, fileName;
+	if (pos == std::string::npos)
+		fileName = arg;
+	else {
+		treeName = arg.substr(0, pos);
+		fileName = arg.substr(pos + 1);
+	}
+
+	std::vector<std::string> names;
+	if (isList(fileName)) {
+		std::ifstream in(fileName.c_str());
+		if (!in.good()) {
+			std::cerr << "File list \"" << fileName << "\" could "
+			             "not be opened for reading." << std::endl;
+			return false;
+		}
+
+		std::string line;
+		while(std::getline(in, line)) {
+			std::string::size_type begin =
+					line.find_first_not_of(" \t");
+			if (begin == std::string::npos || line[begin] == '#')
+				continue;
+			std::string::size_type end =
+					line.find_last_not_of(" \t\r");
+			expand(line.substr(begin, end - begin + 1), names);
+		}
+	} else
+		expand(fileName, names);
+
+	if (names.empty()) {
+		std::cerr << "No input files match \"" << fileName << "\"."
+		          << std::endl;
+		return false;
+	}
+
+	std::vector<File> files;
+	for(std::vector<std::string>::const_iterator iter = names.begin();
+	    iter != names.end(); ++iter) {
+		File file;
+		file.fileName = *iter;
+		file.treeName = treeName;
+		file.entries = -1;
+		file.hasTarget = false;
+		files.push_back(file);
+	}
+	groups.push_back(files);
+
+	return true;
+}
+
+TTree *TreeInputSet::openTree(const std::string &fileName,
+                              const std::string &treeName)
+{
+	TFile *file = TFile::Open(fileName.c_str());
+	if (!file) {
+		std::cerr << "ROOT file \"" << fileName << "\" could not be "
+		             "opened for reading." << std::endl;
+		return 0;
+	}
+
+	TTree *tree = 0;
+	if (treeName.empty()) {
+		TIter next(file->GetListOfKeys());
+		TObject *obj;
+		TString foundName;
+		while((obj = next())) {
+			TString name = static_cast<TKey*>(obj)->GetName();
+			TTree *cur = dynamic_cast<TTree*>(file->Get(name));
+			if (!cur || name == foundName)
+				continue;
+
+			if (tree) {
+				std::cerr << "ROOT file \"" << fileName
+				          << "\" contains more than one tree. "
+				             "Please use <tree>@<file> syntax."
+				          << std::endl;
+				return 0;
+			}
+
+			tree = cur;
+			foundName = name;
+		}
+
+		if (!tree)
+			std::cerr << "ROOT file \"" << fileName << "\" does "
+			             "not contain a tree." << std::endl;
+	} else {
+		tree = dynamic_cast<TTree*>(file->Get(treeName.c_str()));
+
+		if (!tree)
+			std::cerr << "ROOT file \"" << fileName << "\" does "
+			             "not contain a tree named \"" << treeName
+			          << "\"." << std::endl;
+	}
+
+	return tree;
+}
+
+bool TreeInputSet::scanFile(File &file) const
+{
+	TTree *tree = openTree(file.fileName, file.treeName);
+	if (!tree)
+		return false;
+
+	file.treeName = tree->GetName();
+	file.entries = tree->GetEntries();
+	file.hasTarget = tree->GetBranch("__TARGET__") != 0;
+
+	delete tree->GetCurrentFile();
+	return true;
+}
+
+static bool writeAll(int fd, const void *buffer, std::size_t size)
+{
+	const char *p = static_cast<const char*>(buffer);
+	while(size > 0) {
+		ssize_t n = write(fd, p, size);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		size -= n;
+	}
+	return true;
+}
+
+static bool readAll(int fd, void *buffer, std::size_t size)
+{
+	char *p = static_cast<char*>(buffer);
+	while(size > 0) {
+		ssize_t n = read(fd, p, size);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		size -= n;
+	}
+	return true;
+}
+
+// forked worker: scans the files worker, worker + nWorkers, ... in the
+// order of all groups, one record per file (small enough for atomic
+// pipe writes)
+void TreeInputSet::runWorker(unsigned int worker, unsigned int nWorkers,
+                             int fd) const
+{
+	int status = 0;
+	unsigned int index = 0;
+	for(std::vector<std::vector<File> >::const_iterator group =
+			groups.begin(); group != groups.end(); ++group) {
+		for(std::vector<File>::const_iterator iter = group->begin();
+		    iter != group->end(); ++iter, index++) {
+			if (index % nWorkers != worker)
+				continue;
+
+			File file = *iter;
+			Record record;
+			std::memset(&record, 0, sizeof record);
+			record.index = index;
+			try {
+				record.ok = scanFile(file);
+			} catch(const cms::Exception &e) {
+				std::cerr << e.what() << std::endl;
+			} catch(const std::exception &e) {
+				std::cerr << e.what() << std::endl;
+			} catch(...) {
+				std::cerr << "ROOT file \"" << file.fileName
+				          << "\" could not be scanned."
+				          << std::endl;
+			}
+			record.hasTarget = file.hasTarget;
+			record.entries = file.entries;
+			std::strncpy(record.treeName, file.treeName.c_str(),
+			             sizeof record.treeName - 1);
+
+			if (!writeAll(fd, &record, sizeof record)) {
+				status = 1;
+				break;
+			}
+		}
+	}
+
+	std::cout.flush();
+	std::cerr.flush();
+	std::fflush(0);
+	_exit(status);
+}
+
+bool TreeInputSet::scan(unsigned int nWorkers)
+{
+	std::vector<File*> files;
+	for(std::vector<std::vector<File> >::iterator group = groups.begin();
+	    group != groups.end(); ++group)
+		for(std::vector<File>::iterator iter = group->begin();
+		    iter != group->end(); ++iter)
+			files.push_back(&*iter);
+
+	nWorkers = std::min<std::size_t>(nWorkers, files.size());
+	if (nWorkers <= 1) {
+		bool ok = true;
+		for(std::vector<File*>::iterator iter = files.begin();
+		    iter != files.end(); ++iter)
+			ok = scanFile(**iter) && ok;
+		return ok;
+	}
+
+	std::vector<pid_t> pids;
+	std::vector<struct pollfd> fds;
+	for(unsigned int i = 0; i < nWorkers; i++) {
+		int fd[2];
+		if (pipe(fd) < 0)
+			break;
+
+		std::cout.flush();
+		std::cerr.flush();
+		std::fflush(0);
+
+		pid_t pid = fork();
+		if (pid < 0) {
+			close(fd[0]);
+			close(fd[1]);
+			break;
+		}
+		if (pid == 0) {
+			for(unsigned int j = 0; j < fds.size(); j++)
+				close(fds[j].fd);
+			close(fd[0]);
+			runWorker(i, nWorkers, fd[1]);
+		}
+
+		close(fd[1]);
+		pids.push_back(pid);
+
+		struct pollfd pfd;
+		pfd.fd = fd[0];
+		pfd.events = POLLIN;
+		pfd.revents = 0;
+		fds.push_back(pfd);
+	}
+
+	std::vector<char> received(files.size(), false);
+	std::vector<char> ok(files.size(), false);
+	unsigned int open = fds.size();
+	while(open > 0) {
+		if (poll(&fds.front(), fds.size(), -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+
+		for(unsigned int i = 0; i < fds.size(); i++) {
+			if (fds[i].fd < 0 || !fds[i].revents)
+				continue;
+
+			Record record;
+			if (!readAll(fds[i].fd, &record, sizeof record) ||
+			    record.index >= files.size()) {
+				close(fds[i].fd);
+				fds[i].fd = -1;
+				open--;
+				continue;
+			}
+
+			File &file = *files[record.index];
+			file.treeName = record.treeName;
+			file.entries = record.entries;
+			file.hasTarget = record.hasTarget;
+			received[record.index] = true;
+			ok[record.index] = record.ok;
+		}
+	}
+
+	for(unsigned int i = 0; i < fds.size(); i++)
+		if (fds[i].fd >= 0)
+			close(fds[i].fd);
+
+	for(unsigned int i = 0; i < pids.size(); i++) {
+		int status;
+		while(waitpid(pids[i], &status, 0) < 0 && errno == EINTR);
+	}
+
+	// the workers print their own errors, files of workers that could
+	// not be started or died are scanned here
+	bool result = true;
+	for(unsigned int i = 0; i < files.size(); i++) {
+		if (!received[i])
+			ok[i] = scanFile(*files[i]);
+		result = result && ok[i];
+	}
+
+	return result;
+}
+
+Long64_t TreeInputSet::getEntries(unsigned int group) const
+{
+	Long64_t entries = 0;
+	for(std::vector<File>::const_iterator iter = groups[group].begin();
+	    iter != groups[group].end(); ++iter)
+		entries += iter->entries;
+	return entries;
+}
+
+bool TreeInputSet::hasTarget(unsigned int group) const
+{
+	for(std::vector<File>::const_iterator iter = groups[group].begin();
+	    iter != groups[group].end(); ++iter)
+		if (!iter->hasTarget)
+			return false;
+	return true;
+}
+
+TTree *TreeInputSet::getTree(unsigned int group) const
+{
+	const std::vector<File> &files = groups[group];
+	TChain *chain = new TChain(files[0].treeName.c_str());
+	for(std::vector<File>::const_iterator iter = files.begin();
+	    iter != files.end(); ++iter)
+		chain->AddFile(iter->fileName.c_str(), iter->entries,
+		               iter->treeName.c_str());
+
+	// the branches are only known once the first tree is loaded, the
+	// other files are opened when the chain gets to them
+	chain->LoadTree(0);
+	return chain;
+}
+
+} // namespace PhysicsTools
@@ -1,4 +1,5 @@
 #include <unistd.h>
+#include <pthread.h>
 #include <functional>
 #include <algorithm>
 #include <iostream>
@@ -7,15 +8,22 @@
 #include <cstddef>
 #include <cstring>
 #include <cstdio>
+#include <string>
 #include <vector>
 #include <memory>
 
 #include <xercesc/dom/DOM.hpp>
 
+#include <RVersion.h>
 #include <TDirectory.h>
 #include <TTree.h>
 #include <TFile.h>
 #include <TCut.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#	include <TROOT.h>
+#else
+#	include <TThread.h>
+#endif
 
 #include "FWCore/Utilities/interface/Exception.h"
 
@@ -28,6 +36,7 @@
 #include "PhysicsTools/MVATrainer/interface/MVATrainer.h"
 #include "PhysicsTools/MVATrainer/interface/SourceVariable.h"
 #include "PhysicsTools/MVATrainer/interface/TrainProcessor.h"
+#include "PhysicsTools/MVATrainer/interface/TreeExportOptions.h"
 
 XERCES_CPP_NAMESPACE_USE
 
@@ -63,6 +72,11 @@ class TreeSaver : public TrainProcessor {
 
     private:
 	void init();
+	void startWriter();
+	void publish();
+	void stopWriter();
+	void writeBuffer(unsigned int index);
+	static void *writerThread(void *arg);
 
 	std::string getTreeName() const
 	{ return trainer->getName() + '_' + (const char*)getName(); }
@@ -76,6 +90,7 @@ class TreeSaver : public TrainProcessor {
 		std::string		name;
 		Variable::Flags		flags;
 		double			value;
+		Float_t			floatValue;
 		std::vector<double>	values;
 		std::vector<double>	*ptr;
 
@@ -83,12 +98,32 @@ class TreeSaver : public TrainProcessor {
 		{ return name == other; }
 	};
 
+	// events copied by trainData, filled into the tree by the writer
+	struct Buffer {
+		unsigned int				events;
+		std::vector<double>			scalars;
+		std::vector<std::vector<double> >	multiples;
+	};
+
+	TreeExportOptions		options;
 	std::auto_ptr<TFile>		file;
 	TTree				*tree;
 	Double_t			weight;
 	Bool_t				target;
 	std::vector<Var>		vars;
 	bool				flagsPassed, begun;
+
+	bool				useWriter;
+	unsigned int			bufferEvents;
+	std::vector<Buffer>		buffers;
+	std::vector<int>		slots;	// per var, < 0: multiple
+	unsigned int			nScalars, nMultiples;
+	unsigned int			head, tail, nFilled;
+	bool				writerRunning, writerDone;
+	std::string			writerError;
+	pthread_t			writer;
+	pthread_mutex_t			mutex;
+	pthread_cond_t			cond;
 };
 
 static TreeSaver::Registry registry("TreeSaver");
@@ -96,12 +131,20 @@ static TreeSaver::Registry registry("TreeSaver");
 TreeSaver::TreeSaver(const char *name, const AtomicId *id,
                    MVATrainer *trainer) :
 	TrainProcessor(name, id, trainer),
-	iteration(ITER_EXPORT), tree(0), flagsPassed(false), begun(false)
+	iteration(ITER_EXPORT), tree(0), flagsPassed(false), begun(false),
+	useWriter(false), bufferEvents(4096), writerRunning(false)
 {
+	pthread_mutex_init(&mutex, 0);
+	pthread_cond_init(&cond, 0);
 }
 
 TreeSaver::~TreeSaver()
 {
+	if (writerRunning)
+		stopWriter();
+
+	pthread_cond_destroy(&cond);
+	pthread_mutex_destroy(&mutex);
 }
 
 void TreeSaver::configure(DOMElement *elem)
@@ -136,12 +179,155 @@ void TreeSaver::configure(DOMElement *elem)
 		var.ptr = 0;
 		vars.push_back(var);
 	}
+
+	for(DOMNode *node = elem->getFirstChild();
+	    node; node = node->getNextSibling()) {
+		if (node->getNodeType() == DOMNode::ELEMENT_NODE &&
+		    !std::strcmp(XMLSimpleStr(node->getNodeName()), "export"))
+			options.configure(static_cast<DOMElement*>(node));
+	}
+
+	// optionally the tree is filled by a writer thread from a ring of
+	// buffers of that many events each
+	useWriter = XMLDocument::readAttribute<bool>(elem, "writer", false);
+	bufferEvents = XMLDocument::readAttribute<unsigned int>(
+					elem, "bufferevents", bufferEvents);
+	buffers.resize(XMLDocument::readAttribute<unsigned int>(
+					elem, "buffers", 4));
+	if (useWriter && (bufferEvents < 1 || buffers.size() < 2))
+		throw cms::Exception("TreeSaver")
+			<< "The writer thread needs at least two buffers "
+			   "of at least one event." << std::endl;
+}
+
+void TreeSaver::startWriter()
+{
+	nScalars = nMultiples = 0;
+	slots.clear();
+	for(std::vector<Var>::const_iterator iter = vars.begin();
+	    iter != vars.end(); ++iter)
+		slots.push_back(iter->flags & Variable::FLAG_MULTIPLE
+		                ? -(int)++nMultiples : (int)nScalars++);
+
+	// weight and target first
+	for(std::vector<Buffer>::iterator iter = buffers.begin();
+	    iter != buffers.end(); ++iter) {
+		iter->events = 0;
+		iter->scalars.resize(bufferEvents * (nScalars + 2));
+		iter->multiples.resize(bufferEvents * nMultiples);
+	}
+
+	head = tail = nFilled = 0;
+	writerDone = false;
+	writerError.clear();
+
+	// from here on gDirectory and the other ROOT globals are kept per
+	// thread, and ROOT's shared state is locked
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+	ROOT::EnableThreadSafety();
+#else
+	TThread::Initialize();
+#endif
+
+	if (pthread_create(&writer, 0, &TreeSaver::writerThread, this))
+		throw cms::Exception("TreeSaver")
+			<< "Could not start the writer thread."
+			<< std::endl;
+	writerRunning = true;
+}
+
+// hands the current buffer to the writer, waits for a free one
+void TreeSaver::publish()
+{
+	pthread_mutex_lock(&mutex);
+	head = (head + 1) % buffers.size();
+	nFilled++;
+	pthread_cond_broadcast(&cond);
+	while(nFilled == buffers.size())
+		pthread_cond_wait(&cond, &mutex);
+	pthread_mutex_unlock(&mutex);
+
+	buffers[head].events = 0;
+}
+
+void TreeSaver::stopWriter()
+{
+	if (buffers[head].events)
+		publish();
+
+	pthread_mutex_lock(&mutex);
+	writerDone = true;
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&mutex);
+
+	pthread_join(writer, 0);
+	writerRunning = false;
+}
+
+void TreeSaver::writeBuffer(unsigned int index)
+{
+	Buffer &buffer = buffers[index];
+	const double *scalars = &buffer.scalars.front();
+	std::vector<std::vector<double> >::iterator multiples =
+						buffer.multiples.begin();
+
+	for(unsigned int i = 0; i < buffer.events; i++) {
+		weight = *scalars++;
+		target = *scalars++ != 0.0;
+		for(unsigned int j = 0; j < vars.size(); j++) {
+			Var &var = vars[j];
+			if (slots[j] < 0)
+				var.values.swap(*multiples++);
+			else {
+				var.value = scalars[slots[j]];
+				var.floatValue = var.value;
+			}
+		}
+		scalars += nScalars;
+
+		tree->Fill();
+	}
+}
+
+void *TreeSaver::writerThread(void *arg)
+{
+	TreeSaver *self = static_cast<TreeSaver*>(arg);
+
+	// the thread's own gDirectory, the baskets are written to the file
+	self->file->cd();
+
+	pthread_mutex_lock(&self->mutex);
+	for(;;) {
+		while(!self->nFilled && !self->writerDone)
+			pthread_cond_wait(&self->cond, &self->mutex);
+		if (!self->nFilled)
+			break;
+		pthread_mutex_unlock(&self->mutex);
+
+		// after an error, the remaining buffers are only drained
+		if (self->writerError.empty()) {
+			try {
+				self->writeBuffer(self->tail);
+			} catch(const std::exception &e) {
+				self->writerError = e.what();
+			}
+		}
+
+		pthread_mutex_lock(&self->mutex);
+		self->tail = (self->tail + 1) % self->buffers.size();
+		self->nFilled--;
+		pthread_cond_broadcast(&self->cond);
+	}
+	pthread_mutex_unlock(&self->mutex);
+
+	return 0;
 }
 
 void TreeSaver::init()
 {
-	tree->Branch("__WEIGHT__", &weight, "__WEIGHT__/D");
-	tree->Branch("__TARGET__", &target, "__TARGET__/O");
+	Int_t basketSize = options.getBasketSize();
+	tree->Branch("__WEIGHT__", &weight, "__WEIGHT__/D", basketSize);
+	tree->Branch("__TARGET__", &target, "__TARGET__/O", basketSize);
 
 	vars.resize(vars.size());
 
@@ -152,10 +338,13 @@ void TreeSaver::init()
 			iter->ptr = &iter->values;
 			tree->Branch(iter->name.c_str(),
 			             "std::vector<double>",
-			             &pos->ptr);
-		} else
+			             &pos->ptr, basketSize);
+		} else if (options.useFloat())
+			tree->Branch(iter->name.c_str(), &pos->floatValue,
+			            (iter->name + "/F").c_str(), basketSize);
+		else
 			tree->Branch(iter->name.c_str(), &pos->value,
-			            (iter->name + "/D").c_str());
+			            (iter->name + "/D").c_str(), basketSize);
 	}
 }
 
@@ -185,9 +374,11 @@ void TreeSaver::trainBegin()
 				<< "Could not open ROOT file for writing."
 				<< std::endl;
 
+		options.apply(file.get());
 		file->cd();
 		tree = new TTree(getTreeName().c_str(),
 		                 "MVATrainer signal and background");
+		options.apply(tree);
 
 		if (!begun && flagsPassed)
 			init();
@@ -201,6 +392,32 @@ void TreeSaver::trainData(const std::vector<double> *values,
 	if (iteration != ITER_EXPORT)
 		return;
 
+	if (useWriter) {
+		if (!writerRunning)
+			startWriter();
+
+		Buffer &buffer = buffers[head];
+		double *scalars = &buffer.scalars[buffer.events *
+		                                  (nScalars + 2)];
+		std::vector<std::vector<double> >::iterator multiples =
+			buffer.multiples.begin() + buffer.events * nMultiples;
+
+		*scalars++ = weight;
+		*scalars++ = target;
+		for(unsigned int i = 0; i < vars.size(); i++, values++) {
+			if (slots[i] < 0)
+				*multiples++ = *values;
+			else if (values->empty())
+				scalars[slots[i]] = -999.0;
+			else
+				scalars[slots[i]] = values->front();
+		}
+
+		if (++buffer.events == bufferEvents)
+			publish();
+		return;
+	}
+
 	this->weight = weight;
 	this->target = target;
 	for(unsigned int i = 0; i < vars.size(); i++, values++) {
@@ -211,6 +428,7 @@ void TreeSaver::trainData(const std::vector<double> *values,
 			var.value = -999.0;
 		else
 			var.value = values->front();
+		var.floatValue = var.value;
 	}
 
 	tree->Fill();
@@ -220,6 +438,14 @@ void TreeSaver::trainEnd()
 {
 	switch(iteration) {
 	    case ITER_EXPORT:
+		if (writerRunning) {
+			stopWriter();
+			if (!writerError.empty())
+				throw cms::Exception("TreeSaver")
+					<< "Writing the tree failed: "
+					<< writerError << std::endl;
+		}
+
 		/* ROOT context-safe */ {
 			ROOTContextSentinel ctx;
 			file->cd();
@@ -1,10 +1,15 @@
 #include <functional>
 #include <algorithm>
+#include <iostream>
 #include <string>
 #include <vector>
 
+#include <sys/time.h>
+
 #include <TString.h>
+#include <TFile.h>
 #include <TTree.h>
+#include <TTreeCacheUnzip.h>
 
 #include "FWCore/Utilities/interface/Exception.h"
 
@@ -13,19 +18,45 @@
 
 #include "PhysicsTools/MVATrainer/interface/MVATrainer.h"
 #include "PhysicsTools/MVATrainer/interface/TreeTrainer.h"
+#include "PhysicsTools/MVATrainer/interface/TreeBranchSelection.h"
 
 namespace PhysicsTools {
 
-TreeTrainer::TreeTrainer()
+namespace {
+	// switches the parallel unzipping for the caches created meanwhile,
+	// then back to the previous mode
+	class ParallelUnzipSentinel {
+	    public:
+		ParallelUnzipSentinel(bool enable) :
+			previous(TTreeCacheUnzip::IsParallelUnzip())
+		{ set(enable); }
+		~ParallelUnzipSentinel() { set(previous); }
+
+	    private:
+		static void set(bool enable)
+		{
+			TTreeCacheUnzip::SetParallelUnzip(
+				enable ? TTreeCacheUnzip::kEnable
+				       : TTreeCacheUnzip::kDisable);
+		}
+
+		bool	previous;
+	};
+}
+
+TreeTrainer::TreeTrainer() :
+	readAhead(30000000), unzipBuffer(0), verbose(false)
 {
 }
 
-TreeTrainer::TreeTrainer(TTree *tree, double weight)
+TreeTrainer::TreeTrainer(TTree *tree, double weight) :
+	readAhead(30000000), unzipBuffer(0), verbose(false)
 {
 	addTree(tree, -1, weight);
 }
 
-TreeTrainer::TreeTrainer(TTree *signal, TTree *background, double weight)
+TreeTrainer::TreeTrainer(TTree *signal, TTree *background, double weight) :
+	readAhead(30000000), unzipBuffer(0), verbose(false)
 {
 	addTree(signal, true, weight);
 	addTree(background, false, weight);
@@ -50,6 +81,7 @@ Calibration::MVAComputer *TreeTrainer::train(const std::string &trainFile,
 void TreeTrainer::reset()
 {
 	readers.clear();
+	trees.clear();
 	std::for_each(weights.begin(), weights.end(),
 	              std::ptr_fun(&::operator delete));
 	weights.clear();
@@ -77,11 +109,78 @@ void TreeTrainer::addTree(TTree *tree, int target, double weight)
 	}
 
 	addReader(reader);
+	trees.back() = tree;
 }
 
 void TreeTrainer::addReader(const TreeReader &reader)
 {
 	readers.push_back(reader);
+	trees.push_back(0);
+}
+
+void TreeTrainer::setPrefetch(Long64_t readAhead, Long64_t unzipBuffer)
+{
+	this->readAhead = readAhead;
+	this->unzipBuffer = unzipBuffer;
+}
+
+static double wallClock()
+{
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return tv.tv_sec + 1.0e-6 * tv.tv_usec;
+}
+
+// Reads only the branches of the input variables, through a TTreeCache
+// reading readAhead bytes ahead.  If setPrefetch() asked for parallel
+// unzipping, a ROOT helper thread decompresses the baskets of the
+// upcoming entries into a buffer of unzipBuffer bytes while this thread
+// trains, the time spent waiting in GetEntry() is what remains of the
+// I/O.  The previous unzipping mode is restored afterwards.
+void TreeTrainer::loop(unsigned int index,
+                       const Calibration::MVAComputer *calib,
+                       const MVAComputer *computer)
+{
+	TreeReader &reader = readers[index];
+	TTree *tree = trees[index];
+
+	ParallelUnzipSentinel unzip(unzipBuffer != 0);
+
+	TreeBranchSelection selection(tree);
+	selection.add(calib);
+	selection.apply(readAhead);
+
+	TFile *file = tree->GetCurrentFile();
+	TTreeCacheUnzip *cache = file ? dynamic_cast<TTreeCacheUnzip*>(
+					file->GetCacheRead(tree)) : 0;
+	if (cache && unzipBuffer > 0)
+		cache->SetUnzipBufferSize(unzipBuffer);
+
+	reader.update();
+
+	double start = wallClock();
+	double wait = 0.0;
+	Long64_t entries = tree->GetEntries();
+	for(Long64_t entry = 0; entry < entries; entry++) {
+		double t = wallClock();
+		tree->GetEntry(entry);
+		wait += wallClock() - t;
+
+		reader.fill(computer);
+	}
+
+	if (verbose) {
+		selection.report(std::cout);
+		std::cout << "Waited " << wait << " s of "
+		          << (wallClock() - start) << " s for the input";
+		if (cache)
+			std::cout << ", " << cache->GetNFound()
+			          << " baskets unzipped ahead, "
+			          << cache->GetNMissed() << " missed";
+		std::cout << "." << std::endl;
+	}
+
+	selection.release();
 }
 
 bool TreeTrainer::iteration(MVATrainer *trainer)
@@ -92,9 +191,12 @@ bool TreeTrainer::iteration(MVATrainer *trainer)
 
 	MVAComputer computer(calib, true);
 
-	std::for_each(readers.begin(), readers.end(),
-	              std::bind2nd(std::mem_fun_ref(&TreeReader::loop),
-	                           &computer));
+	for(unsigned int i = 0; i < readers.size(); i++) {
+		if (trees[i])
+			loop(i, calib, &computer);
+		else
+			readers[i].loop(&computer);
+	}
 
 	return false;
 }
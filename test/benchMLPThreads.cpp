@@ -0,0 +1,72 @@
+#include <iostream>
+#include <cstdlib>
+#include <cstdio>
+
+#include <sys/time.h>
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "PhysicsTools/MVATrainer/plugins/MLP.h"
+
+// Times stochastic MLP training epochs (method 1) with one and several
+// training threads on the same random problem.
+//
+// Usage: benchMLPThreads [<patterns> [<max. threads> [<epochs>]]]
+
+using namespace PhysicsTools;
+
+static double wallClock()
+{
+	struct timeval tv;
+	gettimeofday(&tv, 0);
+	return tv.tv_sec + 1.0e-6 * tv.tv_usec;
+}
+
+static void bench(unsigned int nPatterns, unsigned int threads,
+                  unsigned int epochs)
+{
+	static const unsigned int nIn = 16;
+
+	srandom(0);
+	MLP mlp(nIn, 1, "32:16", 1);
+	mlp.setThreads(threads);
+	mlp.init(nPatterns);
+
+	srandom(1);
+	for(unsigned int i = 0; i < nPatterns; i++) {
+		double x[nIn], t;
+		for(unsigned int j = 0; j < nIn; j++)
+			x[j] = 2.0 * random() / RAND_MAX - 1.0;
+		t = x[0] * x[1] + 0.3 * x[2] - 0.2 * x[5] > 0.0 ? 1 : 0;
+		mlp.set(i, x, &t);
+	}
+
+	double start = wallClock();
+	double error = 0.0;
+	for(unsigned int i = 0; i < epochs; i++)
+		error = mlp.train();
+	double elapsed = wallClock() - start;
+
+	mlp.clear();
+
+	std::printf("threads %2u: %8.3f s per epoch, final error %g\n",
+	            threads, elapsed / epochs, error);
+}
+
+int main(int argc, char **argv)
+{
+	unsigned int nPatterns = argc > 1 ? std::atoi(argv[1]) : 200000;
+	unsigned int maxThreads = argc > 2 ? std::atoi(argv[2]) : 8;
+	unsigned int epochs = argc > 3 ? std::atoi(argv[3]) : 5;
+
+	try {
+		for(unsigned int threads = 1; threads <= maxThreads;
+		    threads *= 2)
+			bench(nPatterns, threads, epochs);
+	} catch(cms::Exception e) {
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
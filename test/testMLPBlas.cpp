@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "PhysicsTools/MVATrainer/plugins/MLP.h"
+#include "PhysicsTools/MVATrainer/plugins/mlp_gen.h"
+#include "PhysicsTools/MVATrainer/plugins/mlp_blas.h"
+
+// Checks the least squares and Cholesky solvers of the bundled linear
+// algebra backend of the MLP against a plain Gaussian elimination.  If
+// the system backend is built in, checks its solvers too and trains the
+// same network with both backends to check that the weights agree.
+
+using namespace PhysicsTools;
+
+static std::vector<double> train(int backend, int method)
+{
+	static const unsigned int nIn = 6;
+	static const unsigned int nPatterns = 5000;
+
+	MLP_Blas = backend;
+
+	// the line search state outlives an MLP, start both runs alike
+	LastAlpha = 0;
+	NLineSearchFail = 0;
+
+	srandom(0);
+	MLP mlp(nIn, 1, "8:4", method);
+	mlp.setBatch(64);
+	mlp.init(nPatterns);
+
+	srandom(1);
+	for(unsigned int i = 0; i < nPatterns; i++) {
+		double x[nIn], t;
+		for(unsigned int j = 0; j < nIn; j++)
+			x[j] = 2.0 * random() / RAND_MAX - 1.0;
+		t = x[0] * x[1] + 0.3 * x[2] - 0.2 * x[5] > 0.0 ? 1 : 0;
+		mlp.set(i, x, &t);
+	}
+
+	for(unsigned int i = 0; i < 10; i++)
+		mlp.train();
+
+	std::vector<double> weights;
+	for(int il = 1; il < NET.Nlayer; il++)
+		weights.insert(weights.end(), NET.vWeights[il],
+		               NET.vWeights[il] +
+		               NET.Nneur[il] * (NET.Nneur[il - 1] + 1));
+
+	mlp.clear();
+	return weights;
+}
+
+static bool compare(int method)
+{
+	std::vector<double> bundled = train(MLP_BLAS_BUNDLED, method);
+	std::vector<double> system = train(MLP_BLAS_SYSTEM, method);
+
+	double maxDiff = 0.0;
+	for(unsigned int i = 0; i < bundled.size(); i++) {
+		double diff = std::abs(bundled[i] - system[i]) /
+		              std::max(1.0, std::abs(bundled[i]));
+		maxDiff = std::max(maxDiff, diff);
+	}
+
+	std::cout << "method " << method << ": " << bundled.size()
+	          << " weights, max. relative difference " << maxDiff
+	          << std::endl;
+
+	return maxDiff < 1.0e-5;
+}
+
+// solves N x = y by Gaussian elimination with partial pivoting
+static std::vector<double> reference(int n, std::vector<double> N,
+                                     std::vector<double> y)
+{
+	for(int k = 0; k < n; k++) {
+		int p = k;
+		for(int i = k + 1; i < n; i++)
+			if (std::abs(N[i * n + k]) > std::abs(N[p * n + k]))
+				p = i;
+		for(int j = 0; j < n; j++)
+			std::swap(N[k * n + j], N[p * n + j]);
+		std::swap(y[k], y[p]);
+
+		for(int i = k + 1; i < n; i++) {
+			double f = N[i * n + k] / N[k * n + k];
+			for(int j = k; j < n; j++)
+				N[i * n + j] -= f * N[k * n + j];
+			y[i] -= f * y[k];
+		}
+	}
+
+	std::vector<double> x(n);
+	for(int i = n - 1; i >= 0; i--) {
+		double t = y[i];
+		for(int j = i + 1; j < n; j++)
+			t -= N[i * n + j] * x[j];
+		x[i] = t / N[i * n + i];
+	}
+	return x;
+}
+
+// solution of a random least squares problem and of its normal
+// equations with the given backends, compared to the reference
+static bool compareSolvers(int nBackends)
+{
+	static const int m = 40, n = 12;
+
+	srandom(2);
+	std::vector<double> A(m * n), b(m), N(n * n, 0.0), y(n, 0.0);
+	for(int i = 0; i < m; i++) {
+		for(int j = 0; j < n; j++)
+			A[i * n + j] = 2.0 * random() / RAND_MAX - 1.0;
+		b[i] = 2.0 * random() / RAND_MAX - 1.0;
+	}
+	for(int j = 0; j < n; j++)
+		for(int k = 0; k < n; k++)
+			for(int i = 0; i < m; i++)
+				N[j * n + k] += A[i * n + j] * A[i * n + k];
+	for(int j = 0; j < n; j++)
+		for(int i = 0; i < m; i++)
+			y[j] += A[i * n + j] * b[i];
+
+	std::vector<double> ref = reference(n, N, y);
+
+	bool ok = true;
+	for(int backend = 0; backend < nBackends; backend++) {
+		MLP_Blas = backend;
+
+		std::vector<double> x[2];
+		std::vector<double> a = A, r = b;
+		if (MLP_Gels(m, n, &a.front(), &r.front()) == 0)
+			x[0].assign(r.begin(), r.begin() + n);
+
+		a = N;
+		r = y;
+		if (MLP_Chol(n, &a.front(), &r.front()) == 0)
+			x[1] = r;
+
+		double maxDiff = 0.0;
+		for(int i = 0; i < 2; i++) {
+			if (x[i].empty()) {
+				maxDiff = HUGE_VAL;
+				break;
+			}
+			for(int j = 0; j < n; j++)
+				maxDiff = std::max(maxDiff,
+				                   std::abs(x[i][j] - ref[j]));
+		}
+
+		std::cout << MLP_BlasName(backend) << " least squares: max. "
+		             "difference to reference " << maxDiff
+		          << std::endl;
+		ok = ok && maxDiff < 1.0e-10;
+	}
+
+	MLP_Blas = MLP_BLAS_BUNDLED;
+	return ok;
+}
+
+int main()
+{
+	bool system = MLP_BlasAvailable(MLP_BLAS_SYSTEM);
+
+	bool ok = true;
+	try {
+		ok = compareSolvers(system ? 2 : 1) && ok;
+
+		if (system) {
+			// steepest descent, BFGS and hybrid linear-BFGS
+			ok = compare(2) && ok;
+			ok = compare(6) && ok;
+			ok = compare(7) && ok;
+		} else
+			std::cout << "SKIPPED: no system BLAS built in, "
+			             "backend comparison not done."
+			          << std::endl;
+	} catch(cms::Exception e) {
+		std::cerr << e.what() << std::endl;
+		ok = false;
+	}
+
+	if (!ok)
+		std::cout << "Backends differ!" << std::endl;
+	else if (system)
+		std::cout << "Backends agree." << std::endl;
+	return ok ? 0 : 1;
+}
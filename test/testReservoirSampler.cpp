@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+
+#include "PhysicsTools/MVATrainer/interface/ReservoirSampler.h"
+
+// Feeds a weighted event stream with a known distribution through the
+// reservoir sampler.  Checks that the reservoir keeps exactly its
+// capacity (or everything, for a short stream) and that the reweighted
+// sums over the kept events estimate the sums over the whole stream
+// without bias, averaged over many independently seeded samplers.
+
+using namespace PhysicsTools;
+
+struct Event {
+	double	x;
+	double	weight;
+};
+
+// x uniform in [0, 1), weights rising with x, every tenth event with a
+// negative weight and every 50th one with a zero weight
+static std::vector<Event> stream(unsigned int n)
+{
+	srandom(0);
+	std::vector<Event> events(n);
+	for(unsigned int i = 0; i < n; i++) {
+		events[i].x = (double)random() / RAND_MAX;
+		events[i].weight = 0.2 + 2.0 * events[i].x * events[i].x;
+		if (i % 10 == 0)
+			events[i].weight *= -0.5;
+		if (i % 50 == 0)
+			events[i].weight = 0.0;
+	}
+	return events;
+}
+
+// sums of the weights, of weight * x and of weight * x over the tail
+// x < 0.2 with small weights, which is rarely kept
+static const unsigned int nSums = 3;
+
+static void sums(const Event &event, double weight, double *sum)
+{
+	sum[0] += weight;
+	sum[1] += weight * event.x;
+	if (event.x < 0.2)
+		sum[2] += weight * event.x;
+}
+
+// the sums estimated from the kept events
+static void sample(const std::vector<Event> &events, unsigned int capacity,
+                   UInt_t seed, double *sum, bool &ok)
+{
+	ReservoirSampler sampler(capacity, seed);
+	std::vector<unsigned int> kept(capacity);
+	for(unsigned int i = 0; i < events.size(); i++) {
+		int slot = sampler.offer(events[i].weight);
+		if (slot < 0)
+			continue;
+		if (events[i].weight == 0.0) {
+			std::cout << "Event with zero weight kept." << std::endl;
+			ok = false;
+		}
+		kept[slot] = i;
+	}
+
+	unsigned int expected = std::min<std::size_t>(capacity,
+				events.size() - (events.size() + 49) / 50);
+	if (sampler.size() != expected ||
+	    sampler.getOffered() != events.size()) {
+		std::cout << "Kept " << sampler.size() << " of "
+		          << sampler.getOffered() << " events, expected "
+		          << expected << " of " << events.size() << "."
+		          << std::endl;
+		ok = false;
+	}
+
+	unsigned int zero = 0;
+	for(unsigned int slot = 0; slot < sampler.size(); slot++) {
+		double weight = sampler.getWeight(slot);
+		zero += weight == 0.0;
+		sums(events[kept[slot]], weight, sum);
+	}
+
+	// only the threshold event is dropped once the reservoir overflows
+	if (zero != (expected < capacity ? 0 : 1)) {
+		std::cout << zero << " kept events with weight zero."
+		          << std::endl;
+		ok = false;
+	}
+}
+
+// mean of the estimates over nRuns samplers, compared to the true sums
+// with a tolerance of four standard errors of the mean
+static bool check(unsigned int nEvents, unsigned int capacity,
+                  unsigned int nRuns)
+{
+	std::vector<Event> events = stream(nEvents);
+
+	double truth[nSums] = { 0.0, 0.0, 0.0 };
+	for(unsigned int i = 0; i < events.size(); i++)
+		sums(events[i], events[i].weight, truth);
+
+	bool ok = true;
+	double mean[nSums] = { 0.0, 0.0, 0.0 }, sq[nSums] = { 0.0, 0.0, 0.0 };
+	for(unsigned int run = 0; run < nRuns; run++) {
+		double est[nSums] = { 0.0, 0.0, 0.0 };
+		sample(events, capacity, run + 1, est, ok);
+		for(unsigned int i = 0; i < nSums; i++) {
+			mean[i] += est[i];
+			sq[i] += est[i] * est[i];
+		}
+	}
+
+	static const char *const names[nSums] =
+			{ "sum w", "sum w x", "sum w x (x < 0.2)" };
+	for(unsigned int i = 0; i < nSums; i++) {
+		mean[i] /= nRuns;
+		double error = std::sqrt(std::max(0.0, sq[i] / nRuns -
+		                                  mean[i] * mean[i]) / nRuns);
+		bool good = std::abs(mean[i] - truth[i]) <=
+		            4.0 * error + 1.0e-9 * std::abs(truth[i]);
+		std::cout << nEvents << " events, capacity " << capacity
+		          << ": " << names[i] << " " << truth[i]
+		          << ", estimated " << mean[i] << " +- " << error
+		          << (good ? "" : " BIASED") << std::endl;
+		ok = ok && good;
+	}
+
+	return ok;
+}
+
+int main()
+{
+	bool ok = true;
+
+	// nothing dropped, the weights are returned unchanged
+	ok = check(1000, 2000, 1) && ok;
+
+	ok = check(100000, 2000, 200) && ok;
+
+	std::cout << (ok ? "Reservoir sampling is unbiased."
+	                 : "Reservoir sampling failed!") << std::endl;
+	return ok ? 0 : 1;
+}
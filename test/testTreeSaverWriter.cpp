@@ -0,0 +1,201 @@
+#include <iostream>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TKey.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include <TObjArray.h>
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "PhysicsTools/MVAComputer/interface/MVAComputer.h"
+#include "PhysicsTools/MVAComputer/interface/Variable.h"
+
+#include "PhysicsTools/MVATrainer/interface/MVATrainer.h"
+
+// Saves the same events with TreeSaver once filling the tree directly and
+// once through the writer thread, and checks that both trees have the
+// same baskets and contents.
+
+using namespace PhysicsTools;
+
+static void writeConfig(const std::string &fileName, bool writer)
+{
+	std::ofstream out(fileName.c_str());
+	out << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\" ?>\n"
+	       "<MVATrainer>\n"
+	       "\t<general>\n"
+	       "\t\t<option name=\"trainfiles\">testTreeSaverWriter_"
+	    << (writer ? "thread" : "direct") << "_%1$s%2$s.%3$s</option>\n"
+	       "\t</general>\n"
+	       "\t<input id=\"input\">\n"
+	       "\t\t<var name=\"x\" multiple=\"false\" optional=\"false\"/>\n"
+	       "\t\t<var name=\"y\" multiple=\"false\" optional=\"true\"/>\n"
+	       "\t\t<var name=\"z\" multiple=\"true\" optional=\"true\"/>\n"
+	       "\t</input>\n"
+	       "\t<processor id=\"save\" name=\"TreeSaver\">\n"
+	       "\t\t<input>\n"
+	       "\t\t\t<var source=\"input\" name=\"x\"/>\n"
+	       "\t\t\t<var source=\"input\" name=\"y\"/>\n"
+	       "\t\t\t<var source=\"input\" name=\"z\"/>\n"
+	       "\t\t</input>\n"
+	       "\t\t<config writer=\"" << (writer ? "true" : "false")
+	    << "\" bufferevents=\"100\" buffers=\"3\">\n"
+	       "\t\t</config>\n"
+	       "\t\t<output>\n"
+	       "\t\t</output>\n"
+	       "\t</processor>\n"
+	       "\t<output>\n"
+	       "\t\t<var source=\"input\" name=\"x\"/>\n"
+	       "\t</output>\n"
+	       "</MVATrainer>\n";
+}
+
+static void train(MVAComputer *computer)
+{
+	static const AtomicId idX("x");
+	static const AtomicId idY("y");
+	static const AtomicId idZ("z");
+
+	srandom(0);
+
+	for(unsigned int i = 0; i < 20000; i++) {
+		std::vector<Variable::Value> values;
+		values.push_back(Variable::Value(MVATrainer::kTargetId,
+		                                 random() % 2 == 0));
+		values.push_back(Variable::Value(idX, random() * 1.0e-6));
+		if (i % 7)
+			values.push_back(Variable::Value(idY, i * 0.5));
+		for(unsigned int j = random() % 4; j > 0; j--)
+			values.push_back(Variable::Value(idZ, random() % 100));
+
+		computer->eval(values);
+	}
+}
+
+static void save(bool writer)
+{
+	std::string config = std::string("testTreeSaverWriter_") +
+	                     (writer ? "thread" : "direct") + ".xml";
+	writeConfig(config, writer);
+
+	MVATrainer trainer(config);
+	for(;;) {
+		std::auto_ptr<Calibration::MVAComputer> calib(
+					trainer.getTrainCalibration());
+
+		if (!calib.get())
+			break;
+
+		std::auto_ptr<MVAComputer> computer(
+					new MVAComputer(calib.get()));
+
+		train(computer.get());
+	}
+}
+
+static TTree *getTree(TFile *file)
+{
+	TKey *key = static_cast<TKey*>(file->GetListOfKeys()->First());
+	return key ? dynamic_cast<TTree*>(key->ReadObj()) : 0;
+}
+
+static bool compare(TTree *direct, TTree *thread)
+{
+	if (direct->GetEntries() != thread->GetEntries()) {
+		std::cout << "Entries differ: " << direct->GetEntries()
+		          << " vs. " << thread->GetEntries() << std::endl;
+		return false;
+	}
+
+	bool ok = true;
+	TObjArray *branches = direct->GetListOfBranches();
+	for(int i = 0; i < branches->GetEntriesFast(); i++) {
+		TBranch *a = static_cast<TBranch*>(branches->UncheckedAt(i));
+		TBranch *b = thread->GetBranch(a->GetName());
+		if (!b) {
+			std::cout << "Branch " << a->GetName() << " missing."
+			          << std::endl;
+			ok = false;
+			continue;
+		}
+
+		bool same = a->GetTotBytes() == b->GetTotBytes() &&
+		            a->GetZipBytes() == b->GetZipBytes() &&
+		            a->GetWriteBasket() == b->GetWriteBasket();
+		for(int j = 0; same && j < a->GetWriteBasket(); j++)
+			same = a->GetBasketBytes()[j] ==
+			       b->GetBasketBytes()[j] &&
+			       a->GetBasketEntry()[j] ==
+			       b->GetBasketEntry()[j];
+
+		std::cout << "Branch " << a->GetName() << ": "
+		          << a->GetWriteBasket() << " baskets, "
+		          << a->GetZipBytes() << " bytes "
+		          << (same ? "identical" : "DIFFER") << std::endl;
+		ok = ok && same;
+	}
+
+	// the leaf values, the vectors through their addresses
+	std::vector<double> *zA = 0, *zB = 0;
+	direct->SetBranchAddress("z", &zA);
+	thread->SetBranchAddress("z", &zB);
+	for(Long64_t entry = 0; ok && entry < direct->GetEntries(); entry++) {
+		direct->GetEntry(entry);
+		thread->GetEntry(entry);
+
+		ok = *zA == *zB;
+		TObjArray *leaves = direct->GetListOfLeaves();
+		for(int i = 0; ok && i < leaves->GetEntriesFast(); i++) {
+			TLeaf *a = static_cast<TLeaf*>(leaves->UncheckedAt(i));
+			if (std::string(a->GetName()) == "z")
+				continue;
+			TLeaf *b = thread->GetLeaf(a->GetName());
+			ok = b && a->GetValue() == b->GetValue();
+		}
+
+		if (!ok)
+			std::cout << "Entry " << entry << " differs."
+			          << std::endl;
+	}
+
+	return ok;
+}
+
+int main()
+{
+	bool ok = false;
+	try {
+		save(false);
+		save(true);
+
+		std::auto_ptr<TFile> direct(TFile::Open(
+				"testTreeSaverWriter_direct_save.root"));
+		std::auto_ptr<TFile> thread(TFile::Open(
+				"testTreeSaverWriter_thread_save.root"));
+		if (!direct.get() || !thread.get())
+			throw cms::Exception("testTreeSaverWriter")
+				<< "Saved trees not found." << std::endl;
+
+		TTree *a = getTree(direct.get());
+		TTree *b = getTree(thread.get());
+		if (!a || !b)
+			throw cms::Exception("testTreeSaverWriter")
+				<< "Saved trees not found." << std::endl;
+
+		ok = compare(a, b);
+	} catch(cms::Exception e) {
+		std::cerr << e.what() << std::endl;
+	}
+
+	std::cout << (ok ? "Trees are identical." : "Trees differ!")
+	          << std::endl;
+	return ok ? 0 : 1;
+}